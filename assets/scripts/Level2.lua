@@ -88,7 +88,8 @@ Level = {
         { type = "texture", id = "bullet-texture",              file = "./../assets/images/bullet.png" },
         { type = "texture", id = "radar-texture",               file = "./../assets/images/radar-spritesheet.png" },
         { type = "font"   , id = "pico8-font-5",                file = "./../assets/fonts/pico8.ttf", font_size = 5 },
-        { type = "font"   , id = "pico8-font-10",               file = "./../assets/fonts/pico8.ttf", font_size = 10 }
+        { type = "font"   , id = "pico8-font-10",               file = "./../assets/fonts/pico8.ttf", font_size = 10 },
+        { type = "sound"  , id = "helicopter-sound",            file = "./../assets/sounds/helicopter.wav" }
     },
 
     ----------------------------------------------------
@@ -148,6 +149,11 @@ Level = {
                     hit_percentage_damage = 10,
                     friendly = true
                 },
+                sound_emitter = {
+                    sound_asset_id = "helicopter-sound",
+                    priority = 3,
+                    volume = 48
+                },
                 keyboard_controller = {
                     up_velocity = { x = 0, y = -50 },
                     right_velocity = { x = 50, y = 0 },
@@ -2785,35 +2791,18 @@ Level = {
                     health_percentage = 100
                 },
                 projectile_emitter = {
-                    projectile_velocity = { x = 0, y = -100 },
+                    projectile_velocity = { x = 0, y = -200 },
                     projectile_duration = 5, -- seconds
                     repeat_frequency = 1, -- seconds
                     hit_percentage_damage = 10,
                     friendly = false
                 },
-                on_update_script = {
-                    [0] =
-                    function(entity, delta_time, ellapsed_time)
-                        -- this function makes the fighter jet move up and down the map shooting projectiles
-                        local current_position_x, current_position_y = get_position(entity)
-                        local current_velocity_x, current_velocity_y = get_velocity(entity)
-
-                        -- if it reaches the top or the bottom of the map
-                        if current_position_y < 10  or current_position_y > map_height - 32 then
-                            set_velocity(entity, 0, current_velocity_y * -1); -- flip the entity y-velocity
-                        else
-                            set_velocity(entity, 0, current_velocity_y); -- do not flip y-velocity
-                        end
-
-                        -- set the transform rotation to match going up or down
-                        if (current_velocity_y < 0) then
-                            set_rotation(entity, 0, 0) -- point up
-                            set_projectile_velocity(entity, 0, -200) -- shoot projectiles up
-                        else
-                            set_rotation(entity, 180, 0) -- point down
-                            set_projectile_velocity(entity, 0, 200) -- shoot projectiles down
-                        end
-                    end
+                patrol_bounds = {
+                    near_margin = { x = 0, y = 10 },
+                    far_margin = { x = 0, y = 32 } -- the size of the jet
+                },
+                face_velocity = {
+                    aim_projectiles = true -- shoot projectiles where the jet heads
                 }
             }
         },
@@ -2853,14 +2842,12 @@ Level = {
                     hit_percentage_damage = 10,
                     friendly = false
                 },
-                on_update_script = {
-                    [0] =
-                    function(entity, delta_time, ellapsed_time)
-                        -- change the position of the the airplane to follow a sine wave movement
-                        local new_x = ellapsed_time * 0.09
-                        local new_y = 200 + (math.sin(ellapsed_time * 0.001) * 50)
-                        set_position(entity, new_x, new_y) -- set the new position
-                    end
+                sine_motion = {
+                    -- fly right along a sine wave
+                    origin = { x = 0, y = 200 },
+                    velocity = { x = 90, y = 0 },
+                    amplitude = { x = 0, y = 50 },
+                    frequency = { x = 0, y = 1 } -- radians per second
                 }
             }
         }
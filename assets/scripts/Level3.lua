@@ -2521,28 +2521,11 @@ Level = {
                 health = {
                     health_percentage = 100
                 },
-                on_update_script = {
-                    [0] =
-                    function(entity, delta_time, ellapsed_time)
-                        -- this function makes the fighter jet move up and down the map shooting projectiles
-                        local current_position_x, current_position_y = get_position(entity)
-                        local current_velocity_x, current_velocity_y = get_velocity(entity)
-
-                        -- if it reaches the top or the bottom of the map
-                        if current_position_y < 10  or current_position_y > map_height - 32 then
-                            set_velocity(entity, 0, current_velocity_y * -1); -- flip the entity y-velocity
-                        else
-                            set_velocity(entity, 0, current_velocity_y); -- do not flip y-velocity
-                        end
-
-                        -- set the transform rotation to match going up or down
-                        if (current_velocity_y < 0) then
-                            set_rotation(entity, 0, 0) -- point up
-                        else
-                            set_rotation(entity, 180, 0) -- point down
-                        end
-                    end
-                }
+                patrol_bounds = {
+                    near_margin = { x = 0, y = 10 },
+                    far_margin = { x = 0, y = 32 } -- the size of the jet
+                },
+                face_velocity = {}
             }
         },
         {
@@ -2574,25 +2557,14 @@ Level = {
                 health = {
                     health_percentage = 100
                 },
-                on_update_script = {
-                    [0] =
-                    function(entity, delta_time, ellapsed_time)
-                        -- change the position of the the airplane to follow a circular path
-                        local radius = 170
-                        local distance_from_origin = 500
-
-                        local angle = ellapsed_time * 0.0009
-
-                        -- calculate the new x-y cartesian position using polar coordinates
-                        local new_x = (math.cos(angle) * radius) + distance_from_origin
-                        local new_y = (math.sin(angle) * radius) + distance_from_origin
-                        set_position(entity, new_x, new_y)
-
-                        -- change the rotation of the sprite to match the circular motion
-                        local angle_in_degrees = 180 + angle * 180 / math.pi
-                        set_rotation(entity, angle_in_degrees, 0)
-                    end
-                }
+                sine_motion = {
+                    -- fly around a circle of radius 170 centered on (500, 500)
+                    origin = { x = 500, y = 500 },
+                    amplitude = { x = 170, y = 170 },
+                    frequency = { x = 0.9, y = 0.9 }, -- radians per second
+                    phase = { x = math.pi / 2, y = 0 } -- a cosine along x
+                },
+                face_velocity = {}
             }
         }
     }
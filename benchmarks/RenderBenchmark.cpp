@@ -0,0 +1,164 @@
+#include "../src/Game/Game.h"
+#include "../src/Game/LevelLoader.h"
+#include "../src/Logger/Logger.h"
+#include "../src/Renderer/RenderSnapshot.h"
+#include "../src/Systems/RenderSystem.h"
+#include "../src/Systems/RenderTextSystem.h"
+#include "../src/Systems/RenderHealthBarSystem.h"
+#include "../src/Systems/VisibilitySystem.h"
+#include "../src/Systems/ScriptSystem.h"
+#include <SDL.h>
+#include <SDL_ttf.h>
+#include <sol/sol.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+/// Width of the software render target, in pixels.
+const int BENCHMARK_WIDTH = 1920;
+/// Height of the software render target, in pixels.
+const int BENCHMARK_HEIGHT = 1080;
+/// Double value representing the ratio of a circle circumference to its diameter.
+const double PI = 3.14159265358979323846;
+
+/// Structure accumulating the measures of one render system over the benchmark.
+struct SystemMeasure {
+    /// String object representing the name of the measured system.
+    std::string name;
+    /// Double value representing the CPU time spent in the system, extraction and submission, in seconds.
+    double seconds = 0.0;
+    /// RenderStats object accumulating the submission counters of the system.
+    RenderStats stats;
+};
+
+/// @brief Elapsed time getter
+/// @return Double value representing the time elapsed since the given performance counter value, in seconds.
+double SecondsSince(Uint64 startCounter) {
+    return static_cast<double>(SDL_GetPerformanceCounter() - startCounter) / SDL_GetPerformanceFrequency();
+}
+
+/// @brief Measured submission
+/// @details Submit the given snapshot and add its cost and counters to the given measure.
+void SubmitMeasured(SDL_Renderer* renderer, const RenderSnapshot& snapshot, SystemMeasure& measure) {
+    const Uint64 startCounter = SDL_GetPerformanceCounter();
+    const RenderStats stats = snapshot.Submit(renderer);
+    measure.seconds += SecondsSince(startCounter);
+    measure.stats.drawCalls += stats.drawCalls;
+    measure.stats.textureSwitches += stats.textureSwitches;
+}
+
+/// Render throughput benchmark: loads a level in a software renderer and drives the render systems along a fixed
+/// camera path, then reports the per-system CPU time, draw calls, texture switches and frames per second.
+/// Usage: paperCraftRenderBenchmark [level number] [number of frames]
+int main(int argc, char* argv[])
+{
+    const int levelNumber = argc > 1 ? std::atoi(argv[1]) : 2;
+    const int numFrames = argc > 2 ? std::atoi(argv[2]) : 600;
+
+    if (SDL_Init(SDL_INIT_TIMER | SDL_INIT_EVENTS) != 0 || TTF_Init() != 0) {
+        Logger::Err("Error initializing SDL.");
+        return 1;
+    }
+
+    SDL_Surface* target = SDL_CreateRGBSurfaceWithFormat(0, BENCHMARK_WIDTH, BENCHMARK_HEIGHT, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDL_Renderer* renderer = target ? SDL_CreateSoftwareRenderer(target) : nullptr;
+    if (!renderer) {
+        Logger::Err("Error creating the software renderer.");
+        return 1;
+    }
+
+    Game::windowWidth = BENCHMARK_WIDTH;
+    Game::windowHeight = BENCHMARK_HEIGHT;
+
+    {
+        sol::state lua;
+        auto registry = std::make_unique<Registry>();
+        auto assetStore = std::make_unique<AssetStore>();
+
+        registry->AddSystem<RenderSystem>();
+        registry->AddSystem<RenderTextSystem>();
+        registry->AddSystem<RenderHealthBarSystem>();
+        registry->AddSystem<VisibilitySystem>();
+        registry->AddSystem<ScriptSystem>();
+        registry->GetSystem<ScriptSystem>().CreateLuaBindings(lua, *registry);
+
+        LevelLoader loader;
+        lua.open_libraries(sol::lib::base, sol::lib::math, sol::lib::os);
+        loader.LoadLevel(lua, registry, assetStore, renderer, levelNumber);
+        registry->Update();
+
+        SystemMeasure visibilityMeasure = {"VisibilitySystem"};
+        SystemMeasure spriteMeasure = {"RenderSystem"};
+        SystemMeasure textMeasure = {"RenderTextSystem"};
+        SystemMeasure healthBarMeasure = {"RenderHealthBarSystem"};
+        RenderSnapshot snapshot;
+
+        auto& visibility = registry->GetSystem<VisibilitySystem>();
+        const Uint64 benchmarkCounter = SDL_GetPerformanceCounter();
+
+        for (int frame = 0; frame < numFrames; frame++) {
+            // Sweep the camera across the whole map along a fixed lissajous path
+            const double t = static_cast<double>(frame) / numFrames;
+            const double rangeX = std::max(Game::mapWidth - BENCHMARK_WIDTH, 0) / 2.0;
+            const double rangeY = std::max(Game::mapHeight - BENCHMARK_HEIGHT, 0) / 2.0;
+            SDL_Rect camera = {
+                    static_cast<int>(rangeX + rangeX * std::sin(2.0 * PI * t)),
+                    static_cast<int>(rangeY + rangeY * std::sin(4.0 * PI * t)),
+                    BENCHMARK_WIDTH,
+                    BENCHMARK_HEIGHT
+            };
+
+            SDL_SetRenderDrawColor(renderer, 21, 21, 21, 255);
+            SDL_RenderClear(renderer);
+
+            Uint64 startCounter = SDL_GetPerformanceCounter();
+            visibility.Update(camera);
+            visibilityMeasure.seconds += SecondsSince(startCounter);
+
+            startCounter = SDL_GetPerformanceCounter();
+            snapshot.Clear();
+            registry->GetSystem<RenderSystem>().Update(snapshot, assetStore, camera, visibility.GetVisibleEntities(), 1.0);
+            spriteMeasure.seconds += SecondsSince(startCounter);
+            SubmitMeasured(renderer, snapshot, spriteMeasure);
+
+            startCounter = SDL_GetPerformanceCounter();
+            snapshot.Clear();
+            registry->GetSystem<RenderTextSystem>().Update(snapshot, assetStore, camera, visibility);
+            textMeasure.seconds += SecondsSince(startCounter);
+            SubmitMeasured(renderer, snapshot, textMeasure);
+
+            startCounter = SDL_GetPerformanceCounter();
+            snapshot.Clear();
+            registry->GetSystem<RenderHealthBarSystem>().Update(snapshot, assetStore, camera, visibility.GetVisibleEntities(), 1.0);
+            healthBarMeasure.seconds += SecondsSince(startCounter);
+            SubmitMeasured(renderer, snapshot, healthBarMeasure);
+
+            SDL_RenderPresent(renderer);
+        }
+
+        const double totalSeconds = SecondsSince(benchmarkCounter);
+
+        std::cout << "Level " << levelNumber << ", " << numFrames << " frames at " << BENCHMARK_WIDTH << "x" << BENCHMARK_HEIGHT << std::endl;
+        std::cout << std::left << std::setw(24) << "system"
+                  << std::right << std::setw(14) << "ms/frame"
+                  << std::setw(14) << "draws/frame"
+                  << std::setw(16) << "switches/frame" << std::endl;
+        for (const auto* measure: {&visibilityMeasure, &spriteMeasure, &textMeasure, &healthBarMeasure}) {
+            std::cout << std::left << std::setw(24) << measure->name << std::right << std::fixed << std::setprecision(3)
+                      << std::setw(14) << measure->seconds * 1000.0 / numFrames
+                      << std::setw(14) << static_cast<double>(measure->stats.drawCalls) / numFrames
+                      << std::setw(16) << static_cast<double>(measure->stats.textureSwitches) / numFrames << std::endl;
+        }
+        std::cout << "frames per second: " << std::fixed << std::setprecision(1) << numFrames / totalSeconds << std::endl;
+    }
+
+    SDL_DestroyRenderer(renderer);
+    SDL_FreeSurface(target);
+    TTF_Quit();
+    SDL_Quit();
+
+    return 0;
+}
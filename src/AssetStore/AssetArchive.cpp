@@ -0,0 +1,79 @@
+#include "AssetArchive.h"
+#include "../Logger/Logger.h"
+#include <algorithm>
+#include <cstring>
+
+bool AssetArchive::Open(const std::string& filePath) {
+    Close();
+    if (!file.Open(filePath)) {
+        return false;
+    }
+
+    const unsigned char* data = file.GetData();
+    const std::size_t size = file.GetSize();
+    if (size < sizeof(AssetArchiveHeader)) {
+        Close();
+        return false;
+    }
+
+    AssetArchiveHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    const std::size_t entriesOffset = sizeof(AssetArchiveHeader);
+    const std::size_t stringTableOffset = entriesOffset + header.numEntries * sizeof(AssetArchiveEntry);
+    if (std::memcmp(header.magic, ASSET_ARCHIVE_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != ASSET_ARCHIVE_VERSION || stringTableOffset + header.stringTableSize > size) {
+        Logger::Err("Invalid asset archive: " + filePath);
+        Close();
+        return false;
+    }
+
+    // Entries are read in place, the packer keeps them aligned
+    const auto* archiveEntries = reinterpret_cast<const AssetArchiveEntry*>(data + entriesOffset);
+    const char* stringTable = reinterpret_cast<const char*>(data + stringTableOffset);
+    for (std::uint32_t i = 0; i < header.numEntries; i++) {
+        const auto& entry = archiveEntries[i];
+        if (entry.keyOffset >= header.stringTableSize || entry.dataOffset > size || entry.dataSize > size - entry.dataOffset) {
+            Logger::Err("Invalid asset archive entry in: " + filePath);
+            Close();
+            return false;
+        }
+        const std::size_t maxKeyLength = header.stringTableSize - entry.keyOffset;
+        const char* key = stringTable + entry.keyOffset;
+        entries.emplace(std::string(key, strnlen(key, maxKeyLength)), &entry);
+    }
+    return true;
+}
+
+void AssetArchive::Close() {
+    entries.clear();
+    file.Close();
+}
+
+bool AssetArchive::IsOpen() const {
+    return file.GetData() != nullptr;
+}
+
+const AssetArchiveEntry* AssetArchive::Find(const std::string& filePath) const {
+    if (entries.empty()) {
+        return nullptr;
+    }
+    auto entry = entries.find(MakeKey(filePath));
+    return entry != entries.end() ? entry->second : nullptr;
+}
+
+const unsigned char* AssetArchive::GetData(const AssetArchiveEntry& entry) const {
+    return file.GetData() + entry.dataOffset;
+}
+
+std::string AssetArchive::MakeKey(const std::string& filePath) {
+    std::string key = filePath;
+    std::replace(key.begin(), key.end(), '\\', '/');
+
+    // Keep what follows the last assets directory, "./../assets/images/boat.png" gives "images/boat.png"
+    const std::string assetsDirectory = "assets/";
+    const auto assetsDirectoryPosition = key.rfind(assetsDirectory);
+    if (assetsDirectoryPosition != std::string::npos) {
+        key.erase(0, assetsDirectoryPosition + assetsDirectory.size());
+    }
+    return key;
+}
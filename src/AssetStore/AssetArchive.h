@@ -0,0 +1,97 @@
+#ifndef ASSETARCHIVE_H
+#define ASSETARCHIVE_H
+
+#include "MappedFile.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+/// Magic number opening every asset archive.
+const char ASSET_ARCHIVE_MAGIC[4] = {'P', 'C', 'P', 'K'};
+/// Version of the asset archive layout.
+const std::uint32_t ASSET_ARCHIVE_VERSION = 1;
+/// Alignment of the data blobs inside the archive, in bytes.
+const std::size_t ASSET_ARCHIVE_ALIGNMENT = 16;
+
+/// Enumeration of the kinds of data stored in an asset archive.
+enum AssetArchiveEntryType: std::uint32_t {
+    /// Raw file content, stored as is.
+    ARCHIVE_ENTRY_RAW = 0,
+    /// Decoded image, stored as tightly packed RGBA32 pixels.
+    ARCHIVE_ENTRY_PIXELS = 1
+};
+
+/// Structure opening an asset archive, followed by the entry table, the string table and the data blobs.
+struct AssetArchiveHeader {
+    /// Magic number of the archive, "PCPK".
+    char magic[4];
+    /// Integer value representing the version of the archive layout.
+    std::uint32_t version;
+    /// Integer value representing the number of entries of the entry table.
+    std::uint32_t numEntries;
+    /// Integer value representing the size of the string table holding the entry keys, in bytes.
+    std::uint32_t stringTableSize;
+};
+
+/// Structure describing one asset of an archive.
+struct AssetArchiveEntry {
+    /// AssetArchiveEntryType value representing the kind of data stored.
+    std::uint32_t type;
+    /// Integer value representing the width of the image, in pixels, zero for raw entries.
+    std::uint32_t width;
+    /// Integer value representing the height of the image, in pixels, zero for raw entries.
+    std::uint32_t height;
+    /// Integer value representing the offset of the null terminated key in the string table.
+    std::uint32_t keyOffset;
+    /// Integer value representing the offset of the data from the start of the archive, in bytes.
+    std::uint64_t dataOffset;
+    /// Integer value representing the size of the data, in bytes.
+    std::uint64_t dataSize;
+};
+
+/// Class responsible for reading the assets packed in an archive by the asset packer.
+/// @details The archive is memory mapped and never copied: the data pointers handed out point inside the mapping and
+/// stay valid as long as the archive is open. Entries are looked up by their path relative to the assets directory.
+/// @file AssetArchive.h
+/// @author Maxime Héliot
+/// @version 0.1.0 18/10/2026
+class AssetArchive {
+private:
+    /// MappedFile object holding the archive content.
+    MappedFile file;
+    /// Map of the archive entries by key.
+    std::unordered_map<std::string, const AssetArchiveEntry*> entries;
+
+public:
+    /// @brief Open an archive
+    /// @details This method is responsible for mapping the given archive and indexing its entries.
+    /// @param filePath: The path of the archive file.
+    /// @return A boolean value representing the success status of the opening, false for a missing or malformed archive.
+    bool Open(const std::string& filePath);
+
+    /// @brief Close the archive
+    /// @details This method is responsible for unmapping the archive, every data pointer handed out becomes invalid.
+    void Close();
+
+    /// @brief Opening status getter
+    /// @return A boolean value representing the opening status of the archive.
+    bool IsOpen() const;
+
+    /// @brief Entry lookup by asset file path
+    /// @param filePath: The path of the asset file, as written in the level scripts.
+    /// @return A pointer to the entry of the asset, nullptr when the archive does not hold it.
+    const AssetArchiveEntry* Find(const std::string& filePath) const;
+
+    /// @brief Entry data getter
+    /// @return A pointer to the first byte of the entry data inside the mapping.
+    const unsigned char* GetData(const AssetArchiveEntry& entry) const;
+
+    /// @brief Compute the key of an asset
+    /// @details The key is the path relative to the assets directory, with forward slashes.
+    /// @param filePath: The path of the asset file.
+    /// @return The key of the asset.
+    static std::string MakeKey(const std::string& filePath);
+};
+
+#endif // ASSETARCHIVE_H //
@@ -2,8 +2,32 @@
 #include "../Logger/Logger.h"
 #include <SDL_image.h>
 #include <SDL_ttf.h>
+#include <SDL_mixer.h>
+#include <cstring>
+#include <fstream>
 
-AssetStore::AssetStore() {
+/// @brief Read the dimensions of a PNG image from its header, without decoding it.
+/// @return A boolean value representing the success status of the read.
+static bool ReadPngSize(const std::string& filePath, SDL_Point& size) {
+    // The 8 bytes signature is followed by the IHDR chunk, its length and tag then the big-endian width and height
+    static const unsigned char PNG_SIGNATURE[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    unsigned char header[24];
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file.read(reinterpret_cast<char*>(header), sizeof(header)) ||
+        std::memcmp(header, PNG_SIGNATURE, sizeof(PNG_SIGNATURE)) != 0 || std::memcmp(header + 12, "IHDR", 4) != 0) {
+        return false;
+    }
+    size.x = (header[16] << 24) | (header[17] << 16) | (header[18] << 8) | header[19];
+    size.y = (header[20] << 24) | (header[21] << 16) | (header[22] << 8) | header[23];
+    return true;
+}
+
+/// @brief Estimate the memory used by a texture of the given dimensions, uploaded as 32 bits pixels.
+static std::size_t TextureBytes(const SDL_Point& size) {
+    return static_cast<std::size_t>(size.x) * static_cast<std::size_t>(size.y) * 4;
+}
+
+AssetStore::AssetStore(): renderThreadId(std::this_thread::get_id()) {
     Logger::Log("AssetStore constructor called!");
 }
 
@@ -13,35 +37,590 @@ AssetStore::~AssetStore() {
 }
 
 void AssetStore::ClearAssets() {
-    for (auto texture: textures)
+    // Let the pending loads finish so that nothing is added behind our back
+    if (jobSystem) {
+        jobSystem->Wait();
+    }
+    for (auto decodedSurface: decodedSurfaces) {
+        SDL_FreeSurface(decodedSurface.second);
+    }
+    decodedSurfaces.clear();
+    for (auto openedFont: openedFonts) {
+        TTF_CloseFont(openedFont.second);
+    }
+    openedFonts.clear();
+
+    std::lock_guard<std::mutex> lock(assetsMutex);
+    for (auto& texture: textures)
     {
-        SDL_DestroyTexture(texture.second);
+        SDL_DestroyTexture(texture.second.texture);
     }
     textures.clear();
+    for (auto retiredTexture: retiredTextures) {
+        SDL_DestroyTexture(retiredTexture.first);
+    }
+    retiredTextures.clear();
+    residentTextureBytes = 0;
+    SDL_DestroyTexture(placeholderTexture);
+    placeholderTexture = nullptr;
 
-    for (auto font : fonts) {
-        TTF_CloseFont(font.second);
+    for (auto& font : fonts) {
+        TTF_CloseFont(font.second.font);
     }
+    for (auto sound: sounds) {
+        Mix_FreeChunk(sound.second);
+    }
+    sounds.clear();
+    for (auto music: musics) {
+        Mix_FreeMusic(music.second);
+    }
+    musics.clear();
     fonts.clear();
+    for (auto retiredFont: retiredFonts) {
+        TTF_CloseFont(retiredFont.first);
+    }
+    retiredFonts.clear();
 }
 
-void AssetStore::AddTexture(SDL_Renderer* renderer, const std::string& assetId, const std::string& filePath) {
-    SDL_Surface* surface = IMG_Load(filePath.c_str());
-    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+void AssetStore::SetTextureLoadMode(TextureLoadMode loadMode) {
+    std::lock_guard<std::mutex> lock(assetsMutex);
+    textureLoadMode = loadMode;
+}
+
+void AssetStore::SetImageCacheEnabled(bool enabled) {
+    imageCache.SetEnabled(enabled);
+}
+
+bool AssetStore::IsPlaceholder(const SDL_Texture* texture) const {
+    return texture && texture == placeholderTexture;
+}
+
+bool AssetStore::MountArchive(const std::string& filePath) {
+    if (!archive.Open(filePath)) {
+        return false;
+    }
+    Logger::Log("Asset archive mounted: " + filePath);
+    return true;
+}
+
+const char* AssetStore::GetArchivedFile(const std::string& filePath, std::size_t& size) const {
+    const AssetArchiveEntry* entry = archive.Find(filePath);
+    if (!entry || entry->type != ARCHIVE_ENTRY_RAW) {
+        size = 0;
+        return nullptr;
+    }
+    size = static_cast<std::size_t>(entry->dataSize);
+    return reinterpret_cast<const char*>(archive.GetData(*entry));
+}
+
+SDL_RWops* AssetStore::OpenFileStream(const std::string& filePath) const {
+    std::size_t archivedSize = 0;
+    const char* archivedFile = GetArchivedFile(filePath, archivedSize);
+    if (archivedFile) {
+        return SDL_RWFromConstMem(archivedFile, static_cast<int>(archivedSize));
+    }
+    return SDL_RWFromFile(filePath.c_str(), "rb");
+}
+
+SDL_Surface* AssetStore::LoadSurface(const std::string& filePath) const {
+    // Packed images are already decoded, the surface only wraps the mapped pixels
+    const AssetArchiveEntry* entry = archive.Find(filePath);
+    if (entry && entry->type == ARCHIVE_ENTRY_PIXELS) {
+        void* pixels = const_cast<unsigned char*>(archive.GetData(*entry));
+        return SDL_CreateRGBSurfaceWithFormatFrom(pixels, static_cast<int>(entry->width), static_cast<int>(entry->height),
+                                                  32, static_cast<int>(entry->width) * 4, SDL_PIXELFORMAT_RGBA32);
+    }
+    return imageCache.Load(filePath);
+}
+
+void AssetStore::BeginLevel() {
+    std::lock_guard<std::mutex> lock(assetsMutex);
+    currentLevelGeneration++;
+}
+
+void AssetStore::SetTextureBudget(std::size_t budget) {
+    std::lock_guard<std::mutex> lock(assetsMutex);
+    textureBudget = budget;
+}
+
+void AssetStore::Update() {
+    if (renderer) {
+        UploadLoadedAssets(renderer);
+    }
+    std::lock_guard<std::mutex> lock(assetsMutex);
+
+    // Destroy the evicted assets no snapshot in flight can refer to anymore
+    auto isExpired = [this](unsigned int retireFrame) { return currentFrame - retireFrame >= TEXTURE_RETIRE_FRAMES; };
+    for (auto retiredTexture = retiredTextures.begin(); retiredTexture != retiredTextures.end();) {
+        if (isExpired(retiredTexture->second)) {
+            SDL_DestroyTexture(retiredTexture->first);
+            retiredTexture = retiredTextures.erase(retiredTexture);
+        } else {
+            retiredTexture++;
+        }
+    }
+    for (auto retiredFont = retiredFonts.begin(); retiredFont != retiredFonts.end();) {
+        if (isExpired(retiredFont->second)) {
+            TTF_CloseFont(retiredFont->first);
+            retiredFont = retiredFonts.erase(retiredFont);
+        } else {
+            retiredFont++;
+        }
+    }
+
+    // Reload what the simulation thread asked for, and release what the previous levels left unused
+    for (auto& texture: textures) {
+        auto& entry = texture.second;
+        if (entry.isReloadRequested) {
+            ReloadTexture(entry);
+        } else if (entry.levelGeneration < currentLevelGeneration && !IsReferenced(texture.first)) {
+            EvictTexture(entry);
+        }
+    }
+    for (auto& font: fonts) {
+        auto& entry = font.second;
+        if (entry.isReloadRequested) {
+            entry.font = OpenFont(entry.filePath, entry.fontSize);
+            entry.state = ASSET_RESIDENT;
+            entry.isReloadRequested = false;
+        } else if (entry.levelGeneration < currentLevelGeneration && !IsReferenced(font.first)) {
+            ReleaseFont(entry);
+        }
+    }
+
+    // Evict the least recently used unreferenced textures until the resident ones fit the budget again
+    while (residentTextureBytes > textureBudget) {
+        TextureEntry* leastRecentlyUsed = nullptr;
+        for (auto& texture: textures) {
+            auto& entry = texture.second;
+            if (!entry.texture || entry.lastUseFrame == currentFrame || IsReferenced(texture.first)) {
+                continue;
+            }
+            if (!leastRecentlyUsed || entry.lastUseFrame < leastRecentlyUsed->lastUseFrame) {
+                leastRecentlyUsed = &entry;
+            }
+        }
+        if (!leastRecentlyUsed) {
+            break;
+        }
+        EvictTexture(*leastRecentlyUsed);
+    }
+
+    currentFrame++;
+}
+
+void AssetStore::AcquireAsset(const std::string& assetId) {
+    std::lock_guard<std::mutex> lock(assetsMutex);
+    assetRefCounts[assetId]++;
+}
+
+void AssetStore::ReleaseAsset(const std::string& assetId) {
+    std::lock_guard<std::mutex> lock(assetsMutex);
+    auto refCount = assetRefCounts.find(assetId);
+    if (refCount != assetRefCounts.end() && --refCount->second <= 0) {
+        assetRefCounts.erase(refCount);
+    }
+}
+
+bool AssetStore::IsReferenced(const std::string& assetId) const {
+    return assetRefCounts.find(assetId) != assetRefCounts.end();
+}
+
+bool AssetStore::DeclareTexture(const std::string& assetId, const std::string& filePath) {
+    std::lock_guard<std::mutex> lock(assetsMutex);
+    auto& entry = textures[assetId];
+    entry.levelGeneration = currentLevelGeneration;
+
+    // An evicted texture of the same file is only reloaded once used
+    if (entry.filePath == filePath) {
+        return false;
+    }
+    EvictTexture(entry);
+    entry.filePath = filePath;
+    entry.state = ASSET_LOADING;
+    return true;
+}
+
+void AssetStore::SetTextureSurface(TextureEntry& entry, SDL_Surface* surface) {
+    EvictTexture(entry);
+    entry.state = ASSET_RESIDENT;
+    entry.lastUseFrame = currentFrame;
+    entry.isReloadRequested = false;
+    if (!surface) {
+        return;
+    }
+
+    entry.size = {surface->w, surface->h};
+    entry.texture = SDL_CreateTextureFromSurface(renderer, surface);
     SDL_FreeSurface(surface);
+    if (entry.texture) {
+        residentTextureBytes += TextureBytes(entry.size);
+    }
+}
+
+bool AssetStore::DeferTextureLoad(const std::string& assetId) {
+    std::lock_guard<std::mutex> lock(assetsMutex);
+    if (textureLoadMode == TEXTURE_LOAD_EAGER || !renderer) {
+        return false;
+    }
+
+    // A single translucent pixel, stretched over the sprites whose texture is still loading
+    if (textureLoadMode == TEXTURE_LOAD_ASYNC_PLACEHOLDER && !placeholderTexture) {
+        const Uint8 placeholderPixel[4] = {128, 128, 128, 96};
+        placeholderTexture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, 1, 1);
+        SDL_UpdateTexture(placeholderTexture, nullptr, placeholderPixel, sizeof(placeholderPixel));
+        SDL_SetTextureBlendMode(placeholderTexture, SDL_BLENDMODE_BLEND);
+    }
+
+    // Not resident yet, the first lookup loads it the same way as an evicted texture
+    textures[assetId].state = ASSET_EVICTED;
+    return true;
+}
+
+void AssetStore::QueueTextureLoad(const std::string& assetId, TextureEntry& entry) {
+    entry.state = ASSET_LOADING;
+    entry.isReloadRequested = false;
+    SubmitLoadJob([this, assetId, filePath = entry.filePath]() {
+        SDL_Surface* surface = LoadSurface(filePath);
+        if (!surface) {
+            Logger::Err("Error decoding the texture " + filePath + ": " + IMG_GetError());
+        }
+        std::lock_guard<std::mutex> lock(loadedAssetsMutex);
+        decodedSurfaces.emplace_back(assetId, surface);
+    });
+}
+
+void AssetStore::ReloadTexture(TextureEntry& entry) {
+    SDL_Surface* surface = LoadSurface(entry.filePath);
+    if (!surface) {
+        Logger::Err("Error reloading the texture " + entry.filePath + ": " + IMG_GetError());
+    }
+    SetTextureSurface(entry, surface);
+}
+
+void AssetStore::EvictTexture(TextureEntry& entry) {
+    if (!entry.texture) {
+        return;
+    }
+    retiredTextures.emplace_back(entry.texture, currentFrame);
+    residentTextureBytes -= TextureBytes(entry.size);
+    entry.texture = nullptr;
+    entry.state = ASSET_EVICTED;
+}
+
+void AssetStore::AddTexture(SDL_Renderer* renderer, const std::string& assetId, const std::string& filePath) {
+    this->renderer = renderer;
+    if (!DeclareTexture(assetId, filePath)) {
+        return;
+    }
+
+    // Headless mode: keep a stub of the texture with its dimensions only
+    if (!renderer) {
+        SDL_Point size = {0, 0};
+        const AssetArchiveEntry* archiveEntry = archive.Find(filePath);
+        if (archiveEntry && archiveEntry->type == ARCHIVE_ENTRY_PIXELS) {
+            size = {static_cast<int>(archiveEntry->width), static_cast<int>(archiveEntry->height)};
+        } else if (!ReadPngSize(filePath, size)) {
+            SDL_Surface* surface = IMG_Load(filePath.c_str());
+            if (surface) {
+                size = {surface->w, surface->h};
+                SDL_FreeSurface(surface);
+            }
+        }
+        std::lock_guard<std::mutex> lock(assetsMutex);
+        auto& entry = textures[assetId];
+        entry.size = size;
+        entry.state = ASSET_RESIDENT;
+        return;
+    }
+
+    if (DeferTextureLoad(assetId)) {
+        return;
+    }
 
-    // Add the texture to the map
-    textures.emplace(assetId, texture);
+    SDL_Surface* surface = LoadSurface(filePath);
+    std::lock_guard<std::mutex> lock(assetsMutex);
+    SetTextureSurface(textures[assetId], surface);
 }
 
 SDL_Texture* AssetStore::GetTexture(const std::string& assetId) {
-    return textures[assetId];
+    std::lock_guard<std::mutex> lock(assetsMutex);
+    auto texture = textures.find(assetId);
+    if (texture == textures.end()) {
+        return nullptr;
+    }
+
+    auto& entry = texture->second;
+    entry.lastUseFrame = currentFrame;
+    if (entry.state == ASSET_EVICTED && renderer) {
+        // Textures can only be created by the thread owning the renderer, the others get it a frame later
+        if (textureLoadMode == TEXTURE_LOAD_ASYNC_PLACEHOLDER) {
+            QueueTextureLoad(texture->first, entry);
+        } else if (std::this_thread::get_id() == renderThreadId) {
+            ReloadTexture(entry);
+        } else {
+            entry.isReloadRequested = true;
+        }
+    }
+    if (!entry.texture && entry.state == ASSET_LOADING && placeholderTexture) {
+        return placeholderTexture;
+    }
+    return entry.texture;
+}
+
+SDL_Point AssetStore::GetTextureSize(const std::string& assetId) const {
+    std::lock_guard<std::mutex> lock(assetsMutex);
+    auto texture = textures.find(assetId);
+    return texture != textures.end() ? texture->second.size : SDL_Point{0, 0};
+}
+
+std::size_t AssetStore::GetResidentTextureBytes() const {
+    std::lock_guard<std::mutex> lock(assetsMutex);
+    return residentTextureBytes;
+}
+
+bool AssetStore::DeclareFont(const std::string& assetId, const std::string& filePath, int fontSize) {
+    std::lock_guard<std::mutex> lock(assetsMutex);
+    auto& entry = fonts[assetId];
+    entry.levelGeneration = currentLevelGeneration;
+
+    if (entry.filePath == filePath && entry.fontSize == fontSize) {
+        return false;
+    }
+    ReleaseFont(entry);
+    entry.filePath = filePath;
+    entry.fontSize = fontSize;
+    entry.state = ASSET_LOADING;
+    return true;
+}
+
+TTF_Font* AssetStore::OpenFont(const std::string& filePath, int fontSize) {
+    std::lock_guard<std::mutex> lock(fontOpenMutex);
+    SDL_RWops* fontStream = OpenFileStream(filePath);
+    return fontStream ? TTF_OpenFontRW(fontStream, 1, fontSize) : nullptr;
+}
+
+void AssetStore::ReleaseFont(FontEntry& entry) {
+    if (!entry.font) {
+        return;
+    }
+    retiredFonts.emplace_back(entry.font, currentFrame);
+    entry.font = nullptr;
+    entry.state = ASSET_EVICTED;
 }
 
 void AssetStore::AddFont(const std::string &assetId, const std::string &filePath, int fontSize) {
-    fonts.emplace(assetId, TTF_OpenFont(filePath.c_str(), fontSize));
+    if (!DeclareFont(assetId, filePath, fontSize)) {
+        return;
+    }
+    TTF_Font* font = OpenFont(filePath, fontSize);
+    std::lock_guard<std::mutex> lock(assetsMutex);
+    auto& entry = fonts[assetId];
+    entry.font = font;
+    entry.state = ASSET_RESIDENT;
 }
 
 TTF_Font* AssetStore::GetFont(const std::string &assetId) {
-    return fonts[assetId];
-}
\ No newline at end of file
+    std::lock_guard<std::mutex> lock(assetsMutex);
+    auto font = fonts.find(assetId);
+    if (font == fonts.end()) {
+        return nullptr;
+    }
+
+    auto& entry = font->second;
+    if (entry.state == ASSET_EVICTED) {
+        // Same as the textures, FreeType is not to be used concurrently with the text rendering of the render thread
+        if (std::this_thread::get_id() == renderThreadId) {
+            entry.font = OpenFont(entry.filePath, entry.fontSize);
+            entry.state = ASSET_RESIDENT;
+        } else {
+            entry.isReloadRequested = true;
+        }
+    }
+    return entry.font;
+}
+
+void AssetStore::AddSound(const std::string& assetId, const std::string& filePath) {
+    Mix_Chunk* sound = nullptr;
+    if (Mix_QuerySpec(nullptr, nullptr, nullptr)) {
+        SDL_RWops* soundStream = OpenFileStream(filePath);
+        sound = soundStream ? Mix_LoadWAV_RW(soundStream, 1) : nullptr;
+        if (!sound) {
+            Logger::Err("Error loading the sound " + filePath + ": " + Mix_GetError());
+        }
+    }
+    std::lock_guard<std::mutex> lock(assetsMutex);
+    Mix_FreeChunk(sounds[assetId]);
+    sounds[assetId] = sound;
+}
+
+Mix_Chunk* AssetStore::GetSound(const std::string& assetId) const {
+    std::lock_guard<std::mutex> lock(assetsMutex);
+    auto sound = sounds.find(assetId);
+    return sound != sounds.end() ? sound->second : nullptr;
+}
+
+void AssetStore::AddMusic(const std::string& assetId, const std::string& filePath) {
+    Mix_Music* music = nullptr;
+    if (Mix_QuerySpec(nullptr, nullptr, nullptr)) {
+        // The stream stays open with the music, which decodes it little by little while playing
+        SDL_RWops* musicStream = OpenFileStream(filePath);
+        music = musicStream ? Mix_LoadMUS_RW(musicStream, 1) : nullptr;
+        if (!music) {
+            Logger::Err("Error loading the music " + filePath + ": " + Mix_GetError());
+        }
+    }
+    std::lock_guard<std::mutex> lock(assetsMutex);
+    Mix_FreeMusic(musics[assetId]);
+    musics[assetId] = music;
+}
+
+Mix_Music* AssetStore::GetMusic(const std::string& assetId) const {
+    std::lock_guard<std::mutex> lock(assetsMutex);
+    auto music = musics.find(assetId);
+    return music != musics.end() ? music->second : nullptr;
+}
+
+void AssetStore::BeginLoadBatch() {
+    currentBatch = std::make_shared<LoadBatch>();
+}
+
+void AssetStore::SubmitLoadJob(std::function<void()> job) {
+    if (!jobSystem) {
+        jobSystem = std::make_unique<JobSystem>();
+    }
+    if (!currentBatch) {
+        jobSystem->Submit(std::move(job));
+        return;
+    }
+
+    auto batch = currentBatch;
+    batch->numPendingJobs++;
+    jobSystem->Submit([batch, job = std::move(job)]() {
+        job();
+        if (--batch->numPendingJobs == 0) {
+            batch->completion.set_value();
+        }
+    });
+}
+
+void AssetStore::AddTextureAsync(SDL_Renderer* renderer, const std::string& assetId, const std::string& filePath) {
+    // Headless mode only reads the image header, there is nothing worth a worker
+    if (!renderer) {
+        AddTexture(renderer, assetId, filePath);
+        return;
+    }
+
+    this->renderer = renderer;
+    if (!DeclareTexture(assetId, filePath) || DeferTextureLoad(assetId)) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(assetsMutex);
+    QueueTextureLoad(assetId, textures[assetId]);
+}
+
+void AssetStore::AddFontAsync(const std::string& assetId, const std::string& filePath, int fontSize) {
+    if (!DeclareFont(assetId, filePath, fontSize)) {
+        return;
+    }
+
+    SubmitLoadJob([this, assetId, filePath, fontSize]() {
+        TTF_Font* font = OpenFont(filePath, fontSize);
+        std::lock_guard<std::mutex> lock(loadedAssetsMutex);
+        openedFonts.emplace_back(assetId, font);
+    });
+}
+
+std::future<void> AssetStore::EndLoadBatch() {
+    if (!currentBatch) {
+        BeginLoadBatch();
+    }
+
+    // Release the reference held while the batch was open, the last job to finish fulfills the promise otherwise
+    auto batch = std::move(currentBatch);
+    auto completion = batch->completion.get_future();
+    if (--batch->numPendingJobs == 0) {
+        batch->completion.set_value();
+    }
+    return completion;
+}
+
+void AssetStore::UploadLoadedAssets(SDL_Renderer* renderer) {
+    // Loaded from another thread (a level reloaded by the simulation thread), the next Update uploads them
+    if (std::this_thread::get_id() != renderThreadId) {
+        return;
+    }
+
+    std::vector<std::pair<std::string, SDL_Surface*>> surfaces;
+    std::vector<std::pair<std::string, TTF_Font*>> loadedFonts;
+    {
+        std::lock_guard<std::mutex> lock(loadedAssetsMutex);
+        surfaces.swap(decodedSurfaces);
+        loadedFonts.swap(openedFonts);
+    }
+
+    this->renderer = renderer;
+    std::lock_guard<std::mutex> lock(assetsMutex);
+    for (auto& decodedSurface: surfaces) {
+        // Drop the images superseded by another declaration meanwhile
+        auto texture = textures.find(decodedSurface.first);
+        if (texture == textures.end() || texture->second.state != ASSET_LOADING) {
+            SDL_FreeSurface(decodedSurface.second);
+            continue;
+        }
+        SetTextureSurface(texture->second, decodedSurface.second);
+    }
+
+    for (auto& loadedFont: loadedFonts) {
+        auto font = fonts.find(loadedFont.first);
+        if (font == fonts.end() || font->second.state != ASSET_LOADING) {
+            TTF_CloseFont(loadedFont.second);
+            continue;
+        }
+        font->second.font = loadedFont.second;
+        font->second.state = ASSET_RESIDENT;
+    }
+}
+
+void AssetStore::ReloadTextureFile(const std::string& filePath) {
+    std::lock_guard<std::mutex> lock(assetsMutex);
+    if (!renderer) {
+        return;
+    }
+
+    // The watched path and the declared one may be spelled differently, compare them below the assets directory
+    const std::string fileKey = AssetArchive::MakeKey(filePath);
+    for (auto& texture: textures) {
+        TextureEntry& entry = texture.second;
+        if (!entry.texture || AssetArchive::MakeKey(entry.filePath) != fileKey) {
+            continue;
+        }
+
+        // Always the loose file, the archive still holds the pixels it was packed with
+        SDL_Surface* surface = imageCache.Load(entry.filePath);
+        if (!surface) {
+            Logger::Err("Error reloading the texture " + entry.filePath + ": " + IMG_GetError());
+            continue;
+        }
+
+        Uint32 format;
+        int width;
+        int height;
+        SDL_QueryTexture(entry.texture, &format, nullptr, &width, &height);
+        if (width != surface->w || height != surface->h) {
+            SetTextureSurface(entry, surface);
+            Logger::Log("Texture " + texture.first + " recreated from " + entry.filePath);
+            continue;
+        }
+
+        SDL_Surface* converted = SDL_ConvertSurfaceFormat(surface, format, 0);
+        SDL_FreeSurface(surface);
+        if (!converted) {
+            continue;
+        }
+        SDL_UpdateTexture(entry.texture, nullptr, converted->pixels, converted->pitch);
+        SDL_FreeSurface(converted);
+        Logger::Log("Texture " + texture.first + " reloaded from " + entry.filePath);
+    }
+}
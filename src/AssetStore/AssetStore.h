@@ -1,26 +1,218 @@
 #ifndef ASSETSTORE_H
 #define ASSETSTORE_H
 
+#include "./AssetArchive.h"
+#include "./ImageCache.h"
+#include "../Concurrency/JobSystem.h"
+#include <atomic>
+#include <cstddef>
+#include <future>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 #include <SDL.h>
 #include <SDL_ttf.h>
+#include <SDL_mixer.h>
+
+/// Default size of the texture memory budget, in bytes.
+const std::size_t DEFAULT_TEXTURE_BUDGET = 256 * 1024 * 1024;
+/// Number of rendered frames an evicted asset is kept alive, so that snapshots still in flight never draw a destroyed one.
+const unsigned int TEXTURE_RETIRE_FRAMES = 4;
+
+/// Enumeration of the ways the textures declared by a level get loaded.
+enum TextureLoadMode {
+    /// Every texture is loaded with the level.
+    TEXTURE_LOAD_EAGER,
+    /// Only the file path is registered, the texture is loaded by its first lookup.
+    TEXTURE_LOAD_ON_FIRST_USE,
+    /// Only the file path is registered, the first lookup queues the decoding and gets a placeholder until its upload.
+    TEXTURE_LOAD_ASYNC_PLACEHOLDER
+};
 
 /// Class responsible for managing all type of assets and store them.
+/// @details Assets are reference counted by the entities using them. Textures left unreferenced are evicted in least
+/// recently used order whenever the resident textures exceed the memory budget, and every unreferenced asset of a
+/// previous level is released. Evicted assets are reloaded from their file on their next use.
 /// @file AssetStore.h
 /// @author Maxime Héliot
 /// @version 0.1.0 12/10/2021
 class AssetStore {
 private:
+    /// Enumeration of the residency states of an asset.
+    enum AssetState {
+        ASSET_LOADING,
+        ASSET_RESIDENT,
+        ASSET_EVICTED
+    };
+
+    /// Structure holding a texture asset with the information needed to evict and reload it.
+    struct TextureEntry {
+        /// Pointer to the texture, nullptr while loading, evicted or stubbed in headless mode.
+        SDL_Texture* texture = nullptr;
+        /// SDL_Point object representing the width (x) and height (y) of the texture, kept once evicted.
+        SDL_Point size = {0, 0};
+        /// String object representing the path of the image file the texture is loaded from.
+        std::string filePath;
+        /// AssetState value representing the residency state of the texture.
+        AssetState state = ASSET_LOADING;
+        /// Integer value representing the number of the last rendered frame the texture was used in.
+        unsigned int lastUseFrame = 0;
+        /// Integer value representing the number of the last level declaring the texture.
+        unsigned int levelGeneration = 0;
+        /// Boolean value representing the reload request status of an evicted texture used off the render thread.
+        bool isReloadRequested = false;
+    };
+
+    /// Structure holding a font asset with the information needed to release and reopen it.
+    struct FontEntry {
+        /// Pointer to the font, nullptr while loading or released.
+        TTF_Font* font = nullptr;
+        /// String object representing the path of the font file.
+        std::string filePath;
+        /// Integer value representing the point size the font is opened with.
+        int fontSize = 0;
+        /// AssetState value representing the residency state of the font.
+        AssetState state = ASSET_LOADING;
+        /// Integer value representing the number of the last level declaring the font.
+        unsigned int levelGeneration = 0;
+        /// Boolean value representing the reopen request status of a released font used off the render thread.
+        bool isReloadRequested = false;
+    };
+
     /// A map of the different game sprites - textures
-    std::map<std::string, SDL_Texture*> textures;
+    std::map<std::string, TextureEntry> textures;
     // A map of the different game fonts
-    std::map<std::string, TTF_Font*> fonts;
-    // TODO: create a map for audio
+    std::map<std::string, FontEntry> fonts;
+    /// A map of the different game sound effects, preloaded
+    std::map<std::string, Mix_Chunk*> sounds;
+    /// A map of the different game musics, streamed while playing
+    std::map<std::string, Mix_Music*> musics;
+    /// Map of the number of live components referencing each asset id.
+    std::unordered_map<std::string, int> assetRefCounts;
+    /// Vector of the evicted textures waiting for the snapshots in flight to be submitted, with their eviction frame.
+    std::vector<std::pair<SDL_Texture*, unsigned int>> retiredTextures;
+    /// Vector of the released fonts waiting for the snapshots in flight to be submitted, with their release frame.
+    std::vector<std::pair<TTF_Font*, unsigned int>> retiredFonts;
+    /// Mutex guarding the asset maps and reference counts, looked up by the simulation thread in pipelined mode.
+    mutable std::mutex assetsMutex;
+    /// Pointer to the renderer the textures are created with, nullptr in headless mode.
+    SDL_Renderer* renderer = nullptr;
+    /// Id of the thread owning the renderer, the only one allowed to create and destroy textures.
+    std::thread::id renderThreadId;
+    /// Integer value representing the number of rendered frames, used to order the textures by last use.
+    unsigned int currentFrame = 1;
+    /// Integer value representing the number of the level currently loaded.
+    unsigned int currentLevelGeneration = 0;
+    /// Integer value representing the memory budget of the resident textures, in bytes.
+    std::size_t textureBudget = DEFAULT_TEXTURE_BUDGET;
+    /// Integer value representing the estimated memory used by the resident textures, in bytes.
+    std::size_t residentTextureBytes = 0;
+    /// TextureLoadMode value representing the way the declared textures get loaded.
+    TextureLoadMode textureLoadMode = TEXTURE_LOAD_EAGER;
+    /// Pointer to the texture handed out in place of the textures still loading.
+    SDL_Texture* placeholderTexture = nullptr;
+
+    /// Structure tracking the completion of the asynchronous loads queued between two load batch boundaries.
+    struct LoadBatch {
+        /// Integer value representing the number of unfinished jobs, plus one while the batch is still open.
+        std::atomic<int> numPendingJobs{1};
+        /// Promise fulfilled once every job of the batch completed.
+        std::promise<void> completion;
+    };
+
+    /// Load batch receiving the asynchronous loads currently queued.
+    std::shared_ptr<LoadBatch> currentBatch;
+    /// Vector of the images decoded by the workers, waiting for their upload on the main thread.
+    std::vector<std::pair<std::string, SDL_Surface*>> decodedSurfaces;
+    /// Vector of the fonts opened by the workers, waiting to be added to the font map on the main thread.
+    std::vector<std::pair<std::string, TTF_Font*>> openedFonts;
+    /// Mutex guarding the decoded surfaces and opened fonts lists.
+    std::mutex loadedAssetsMutex;
+    /// Mutex serializing the font opening, SDL_ttf sharing a single FreeType library between all fonts.
+    std::mutex fontOpenMutex;
+    /// AssetArchive object holding the packed assets, looked up before the loose files when open.
+    AssetArchive archive;
+    /// ImageCache object keeping the decoded pixels of the loose images between two runs.
+    ImageCache imageCache;
+    /// JobSystem object running the asynchronous loads, started on the first one.
+    /// @details Declared last so that its workers are joined before the lists they fill get destroyed.
+    std::unique_ptr<JobSystem> jobSystem;
+
+    /// @brief Queue an asynchronous load job
+    /// @details This method is responsible for running the given job on the worker pool as part of the current load batch.
+    void SubmitLoadJob(std::function<void()> job);
+
+    /// @brief Open a file for reading
+    /// @details This method is responsible for opening a read stream over a file, inside the archive mapping when packed.
+    /// @return A read stream owned by the caller, nullptr on failure.
+    SDL_RWops* OpenFileStream(const std::string& filePath) const;
+
+    /// @brief Load an image
+    /// @details This method is responsible for returning the pixels of an image, straight from the archive mapping when
+    /// packed, or from the image cache otherwise. Safe to call from the workers.
+    /// @return A surface owned by the caller, nullptr on failure.
+    SDL_Surface* LoadSurface(const std::string& filePath) const;
+
+    /// @brief Declare a texture asset
+    /// @details This method is responsible for creating or refreshing the entry of a texture declared by the current level.
+    /// A texture already resident under the same file is kept as is.
+    /// @return A boolean value representing the need to load the texture image.
+    bool DeclareTexture(const std::string& assetId, const std::string& filePath);
+
+    /// @brief Make a texture resident
+    /// @details This method is responsible for giving its texture to an entry, taking ownership of the surface. Must be
+    /// called with the assets mutex locked.
+    void SetTextureSurface(TextureEntry& entry, SDL_Surface* surface);
+
+    /// @brief Register a texture without loading it
+    /// @details This method is responsible for leaving a declared texture to be loaded by its first lookup, in the
+    /// lazy load modes. Must be called from the render thread.
+    /// @return A boolean value representing the deferral of the load.
+    bool DeferTextureLoad(const std::string& assetId);
+
+    /// @brief Queue the decoding of a texture
+    /// @details This method is responsible for decoding a texture image on the worker pool, the upload being done by
+    /// the next Update call. Must be called with the assets mutex locked.
+    void QueueTextureLoad(const std::string& assetId, TextureEntry& entry);
+
+    /// @brief Reload an evicted texture
+    /// @details This method is responsible for decoding and uploading again the image of an evicted texture. Must be
+    /// called from the render thread with the assets mutex locked.
+    void ReloadTexture(TextureEntry& entry);
+
+    /// @brief Evict a texture
+    /// @details This method is responsible for releasing the texture of an entry, its destruction being deferred until
+    /// no snapshot in flight can use it anymore. Must be called with the assets mutex locked.
+    void EvictTexture(TextureEntry& entry);
+
+    /// @brief Declare a font asset
+    /// @details This method is responsible for creating or refreshing the entry of a font declared by the current level.
+    /// A font already opened from the same file and size is kept as is.
+    /// @return A boolean value representing the need to open the font file.
+    bool DeclareFont(const std::string& assetId, const std::string& filePath, int fontSize);
+
+    /// @brief Open a font
+    /// @details This method is responsible for opening a font file, serialized with the other font openings.
+    TTF_Font* OpenFont(const std::string& filePath, int fontSize);
+
+    /// @brief Release a font
+    /// @details This method is responsible for closing the font of an entry, deferred as for the evicted textures.
+    /// Must be called with the assets mutex locked.
+    void ReleaseFont(FontEntry& entry);
+
+    /// @brief Asset reference check
+    /// @return A boolean value representing the use of the given asset by at least one component. Must be called
+    /// with the assets mutex locked.
+    bool IsReferenced(const std::string& assetId) const;
 
 public:
     /// @brief Default AssetStore constructor
-    /// @details Base constructor of the AssetStore class.
+    /// @details Base constructor of the AssetStore class. Must be called from the thread owning the renderer.
     AssetStore();
 
     /// @brief Default AssetStore destructor
@@ -31,21 +223,135 @@ public:
     /// @details This method is responsible for clear all the different assets of all the asset maps type.
     void ClearAssets();
 
+    /// @brief Texture load mode setter
+    /// @details This method is responsible for choosing how the textures declared from now on get loaded.
+    /// @param loadMode: TextureLoadMode value to set.
+    void SetTextureLoadMode(TextureLoadMode loadMode);
+
+    /// @brief Image cache enabled status setter
+    /// @details This method is responsible for enabling the on-disk cache of the decoded images. Must be called before adding any asset.
+    /// @param enabled: Boolean value representing the enabled status to set.
+    void SetImageCacheEnabled(bool enabled);
+
+    /// @brief Placeholder check
+    /// @return A boolean value representing the given texture being the placeholder of a texture still loading.
+    bool IsPlaceholder(const SDL_Texture* texture) const;
+
+    /// @brief Mount an asset archive
+    /// @details This method is responsible for mapping the archive built by the asset packer. The assets it holds are
+    /// then loaded from it instead of their loose files. Must be called before adding any asset.
+    /// @param filePath: The path of the archive file.
+    /// @return A boolean value representing the success status of the mounting.
+    bool MountArchive(const std::string& filePath);
+
+    /// @brief Packed file getter
+    /// @details This method is responsible for looking up the raw content of a file in the mounted archive.
+    /// @param filePath: The path of the file, as written in the level scripts.
+    /// @param size: Integer value set to the size of the file content, in bytes.
+    /// @return A pointer to the file content inside the archive mapping, nullptr when the file is not packed.
+    const char* GetArchivedFile(const std::string& filePath, std::size_t& size) const;
+
+    /// @brief Start a new level
+    /// @details This method is responsible for marking every asset declared so far as belonging to a previous level.
+    /// Those left unreferenced are released by the next Update call, unless the new level declares them again.
+    void BeginLevel();
+
+    /// @brief Texture budget setter
+    /// @details This method is responsible for setting the memory budget of the resident textures.
+    /// @param budget: Integer value representing the budget, in bytes.
+    void SetTextureBudget(std::size_t budget);
+
+    /// @brief Asset store update method
+    /// @details This method is responsible for uploading the textures decoded in the background, reloading the textures
+    /// requested off the render thread, releasing the unreferenced assets of previous levels and evicting the least
+    /// recently used unreferenced textures while over budget. Must be called once per rendered frame from the render thread.
+    void Update();
+
+    /// @brief Acquire an asset reference
+    /// @details This method is responsible for counting a new component using the given asset, preventing its eviction.
+    void AcquireAsset(const std::string& assetId);
+
+    /// @brief Release an asset reference
+    /// @details This method is responsible for forgetting a component which used the given asset.
+    void ReleaseAsset(const std::string& assetId);
+
     /// @brief Add texture type asset
     /// @details This method is responsible for adding a texture to the asset store.
+    /// Without renderer (headless mode), the texture is only stubbed with its dimensions and the image is not decoded.
     void AddTexture(SDL_Renderer* renderer, const std::string& assetId, const std::string& filePath);
 
     /// @brief Texture asset getter by id
     /// @details This method is responsible for returning the texture associated to a given id in the texture assets map.
+    /// An evicted or not yet loaded texture is reloaded right away on the render thread, or during the next Update call
+    /// otherwise. In the asynchronous placeholder mode, its decoding is queued instead and the placeholder is returned.
     SDL_Texture* GetTexture(const std::string& assetId);
 
+    /// @brief Texture asset dimensions getter by id
+    /// @details This method is responsible for returning the width (x) and height (y) of the texture associated to a given id.
+    SDL_Point GetTextureSize(const std::string& assetId) const;
+
+    /// @brief Resident textures memory getter
+    /// @return The estimated memory used by the resident textures, in bytes.
+    std::size_t GetResidentTextureBytes() const;
+
     /// @brief Add font type asset
     /// @details This method is responsible for adding a font to the asset store.
     void AddFont(const std::string& assetId, const std::string& filePath, int fontSize);
 
     /// @brief Font asset getter by id
     /// @details This method is responsible for returning the font associated to a given id in the font assets map.
+    /// A released font is reopened on its next use.
     TTF_Font* GetFont(const std::string& assetId);
+
+    /// @brief Add sound type asset
+    /// @details This method is responsible for decoding a short sound effect in memory, so that playing it never reads a file.
+    /// Without audio device (headless mode), the sound is only registered.
+    void AddSound(const std::string& assetId, const std::string& filePath);
+
+    /// @brief Sound asset getter by id
+    /// @return The sound associated to the given id, nullptr if unknown or without audio device.
+    Mix_Chunk* GetSound(const std::string& assetId) const;
+
+    /// @brief Add music type asset
+    /// @details This method is responsible for opening a long track, decoded on the fly while it plays.
+    /// Without audio device (headless mode), the music is only registered.
+    void AddMusic(const std::string& assetId, const std::string& filePath);
+
+    /// @brief Music asset getter by id
+    /// @return The music associated to the given id, nullptr if unknown or without audio device.
+    Mix_Music* GetMusic(const std::string& assetId) const;
+
+    /// @brief Open a load batch
+    /// @details This method is responsible for starting a new group of asynchronous loads, typically the assets of one level.
+    /// The asynchronous loads queued outside of any batch are not tracked.
+    void BeginLoadBatch();
+
+    /// @brief Add texture type asset asynchronously
+    /// @details This method is responsible for decoding an image on the worker pool. The texture itself is only created
+    /// by the next UploadLoadedAssets call. Without renderer (headless mode), the texture is stubbed right away as in AddTexture.
+    void AddTextureAsync(SDL_Renderer* renderer, const std::string& assetId, const std::string& filePath);
+
+    /// @brief Add font type asset asynchronously
+    /// @details This method is responsible for opening a font on the worker pool. The font is only available once the
+    /// next UploadLoadedAssets call moved it to the asset store.
+    void AddFontAsync(const std::string& assetId, const std::string& filePath, int fontSize);
+
+    /// @brief Close the current load batch
+    /// @details This method is responsible for closing the current group of asynchronous loads.
+    /// @return A future made ready once every decode and font opening of the batch completed.
+    std::future<void> EndLoadBatch();
+
+    /// @brief Upload the asynchronously loaded assets
+    /// @details This method is responsible for creating, on the main thread and in one go, the textures of every image
+    /// decoded so far, and for adding the fonts opened so far to the asset store.
+    void UploadLoadedAssets(SDL_Renderer* renderer);
+
+    /// @brief Reload the textures of a changed image file
+    /// @details This method is responsible for decoding again the given image file and for updating in place the pixels
+    /// of every resident texture loaded from it, so the texture pointers held elsewhere stay valid. A texture whose
+    /// size changed is recreated instead. Must be called on the thread owning the renderer.
+    /// @param filePath: The path of the changed image file.
+    void ReloadTextureFile(const std::string& filePath);
 };
 
 #endif // ASSETSTORE_H //
@@ -0,0 +1,178 @@
+#include "ImageCache.h"
+#include "../Logger/Logger.h"
+#include <SDL_image.h>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+/// Magic number opening every cache file.
+static const char IMAGE_CACHE_MAGIC[4] = {'P', 'C', 'I', 'C'};
+/// Version of the cache file layout.
+static const std::uint32_t IMAGE_CACHE_VERSION = 1;
+
+/// Structure opening a cache file, followed by the tightly packed RGBA32 pixels.
+struct ImageCacheHeader {
+    /// Magic number of the cache file, "PCIC".
+    char magic[4];
+    /// Integer value representing the version of the cache file layout.
+    std::uint32_t version;
+    /// Integer value representing the modification time of the image when it was cached.
+    std::int64_t modificationTime;
+    /// Integer value representing the size of the image file when it was cached, in bytes.
+    std::uint64_t fileSize;
+    /// Integer value representing the hash of the image file content when it was cached.
+    std::uint64_t contentHash;
+    /// Integer value representing the width of the image, in pixels.
+    std::uint32_t width;
+    /// Integer value representing the height of the image, in pixels.
+    std::uint32_t height;
+};
+
+/// @brief Read the pixels following the header of a cache file.
+/// @return A surface owned by the caller, nullptr on failure.
+static SDL_Surface* ReadPixels(std::istream& cacheFile, const ImageCacheHeader& header) {
+    SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormat(0, static_cast<int>(header.width), static_cast<int>(header.height), 32, SDL_PIXELFORMAT_RGBA32);
+    if (!surface) {
+        return nullptr;
+    }
+    const std::size_t rowSize = static_cast<std::size_t>(header.width) * 4;
+    for (int y = 0; y < surface->h; y++) {
+        if (!cacheFile.read(static_cast<char*>(surface->pixels) + y * surface->pitch, rowSize)) {
+            SDL_FreeSurface(surface);
+            return nullptr;
+        }
+    }
+    return surface;
+}
+
+ImageCache::ImageCache(std::string directory): directory(std::move(directory)) {}
+
+void ImageCache::SetEnabled(bool enabled) {
+    isEnabled = enabled;
+}
+
+std::uint64_t ImageCache::Hash(const void* data, std::size_t size, std::uint64_t seed) {
+    std::uint64_t hash = seed;
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (std::size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+std::string ImageCache::GetCachePath(const std::string& filePath) const {
+    static const char hexDigits[] = "0123456789abcdef";
+    std::uint64_t pathHash = Hash(filePath.data(), filePath.size());
+    std::string fileName(16, '0');
+    for (int i = 15; i >= 0; i--) {
+        fileName[i] = hexDigits[pathHash & 0xF];
+        pathHash >>= 4;
+    }
+    return directory + "/" + fileName + ".pcic";
+}
+
+SDL_Surface* ImageCache::Load(const std::string& filePath) const {
+    if (!isEnabled) {
+        return IMG_Load(filePath.c_str());
+    }
+
+    std::error_code error;
+    const std::int64_t modificationTime = static_cast<std::int64_t>(fs::last_write_time(filePath, error).time_since_epoch().count());
+    const std::uint64_t fileSize = error ? 0 : static_cast<std::uint64_t>(fs::file_size(filePath, error));
+    if (error) {
+        return IMG_Load(filePath.c_str());
+    }
+
+    const std::string cachePath = GetCachePath(filePath);
+    std::vector<unsigned char> fileContent;
+    bool isContentRead = false;
+
+    std::ifstream cacheFile(cachePath, std::ios::binary);
+    ImageCacheHeader header;
+    if (cacheFile.read(reinterpret_cast<char*>(&header), sizeof(header)) &&
+        std::memcmp(header.magic, IMAGE_CACHE_MAGIC, sizeof(header.magic)) == 0 && header.version == IMAGE_CACHE_VERSION) {
+        bool isValid = header.modificationTime == modificationTime && header.fileSize == fileSize;
+        bool isTouched = false;
+
+        // A touched file whose content did not change keeps its cache
+        if (!isValid) {
+            std::ifstream imageFile(filePath, std::ios::binary);
+            fileContent.assign(std::istreambuf_iterator<char>(imageFile), std::istreambuf_iterator<char>());
+            isContentRead = true;
+            isValid = fileContent.size() == fileSize && Hash(fileContent.data(), fileContent.size()) == header.contentHash;
+            isTouched = isValid;
+        }
+
+        if (isValid) {
+            SDL_Surface* surface = ReadPixels(cacheFile, header);
+            if (surface) {
+                // Written again whole with the new modification time, never patched in place
+                if (isTouched) {
+                    cacheFile.close();
+                    Store(cachePath, surface, modificationTime, header.fileSize, header.contentHash);
+                }
+                return surface;
+            }
+        }
+    }
+    cacheFile.close();
+
+    // Decode the image from the bytes read for the hash, and cache its pixels for the next runs
+    if (!isContentRead) {
+        std::ifstream imageFile(filePath, std::ios::binary);
+        fileContent.assign(std::istreambuf_iterator<char>(imageFile), std::istreambuf_iterator<char>());
+    }
+    SDL_Surface* image = IMG_Load_RW(SDL_RWFromConstMem(fileContent.data(), static_cast<int>(fileContent.size())), 1);
+    if (!image) {
+        return nullptr;
+    }
+    SDL_Surface* pixels = SDL_ConvertSurfaceFormat(image, SDL_PIXELFORMAT_RGBA32, 0);
+    SDL_FreeSurface(image);
+    if (!pixels) {
+        return nullptr;
+    }
+    Store(cachePath, pixels, modificationTime, fileContent.size(), Hash(fileContent.data(), fileContent.size()));
+    return pixels;
+}
+
+void ImageCache::Store(const std::string& cachePath, SDL_Surface* surface, std::int64_t modificationTime,
+                       std::uint64_t fileSize, std::uint64_t contentHash) const {
+    std::error_code error;
+    fs::create_directories(directory, error);
+
+    ImageCacheHeader header;
+    std::memcpy(header.magic, IMAGE_CACHE_MAGIC, sizeof(header.magic));
+    header.version = IMAGE_CACHE_VERSION;
+    header.modificationTime = modificationTime;
+    header.fileSize = fileSize;
+    header.contentHash = contentHash;
+    header.width = static_cast<std::uint32_t>(surface->w);
+    header.height = static_cast<std::uint32_t>(surface->h);
+
+    const std::string temporaryPath = cachePath + "." + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) + ".tmp";
+    {
+        std::ofstream temporaryFile(temporaryPath, std::ios::binary);
+        temporaryFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        const std::size_t rowSize = static_cast<std::size_t>(surface->w) * 4;
+        for (int y = 0; y < surface->h; y++) {
+            temporaryFile.write(static_cast<const char*>(surface->pixels) + y * surface->pitch, rowSize);
+        }
+        if (!temporaryFile) {
+            Logger::Err("Error writing the image cache file " + temporaryPath);
+            temporaryFile.close();
+            fs::remove(temporaryPath, error);
+            return;
+        }
+    }
+    fs::rename(temporaryPath, cachePath, error);
+    if (error) {
+        fs::remove(temporaryPath, error);
+    }
+}
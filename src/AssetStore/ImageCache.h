@@ -0,0 +1,55 @@
+#ifndef IMAGECACHE_H
+#define IMAGECACHE_H
+
+#include <cstdint>
+#include <string>
+#include <SDL.h>
+
+/// Class responsible for keeping decoded copies of the images on disk, so that they are only decoded once.
+/// @details Each image gets a cache file named after the hash of its path, holding a small header followed by its raw
+/// RGBA32 pixels. A cache file is used as long as the size and modification time of its image are unchanged, or, when
+/// they changed, as long as the image content hash is still the same. Otherwise the image is decoded and cached again.
+/// @file ImageCache.h
+/// @author Maxime Héliot
+/// @version 0.1.0 18/10/2026
+class ImageCache {
+private:
+    /// String object representing the directory holding the cache files.
+    std::string directory;
+    /// Boolean value representing the enabled status of the cache.
+    bool isEnabled = true;
+
+    /// @brief Cache file path getter
+    /// @return The path of the cache file of the given image.
+    std::string GetCachePath(const std::string& filePath) const;
+
+    /// @brief Write a cache file
+    /// @details This method is responsible for writing the pixels of a RGBA32 surface to a cache file, through a
+    /// temporary file so that a concurrent reader never sees a partial file.
+    void Store(const std::string& cachePath, SDL_Surface* surface, std::int64_t modificationTime, std::uint64_t fileSize,
+               std::uint64_t contentHash) const;
+
+public:
+    /// @brief Default ImageCache constructor
+    /// @details Base constructor of the ImageCache class.
+    /// @param directory: The directory holding the cache files, created on the first write.
+    explicit ImageCache(std::string directory = "./cache");
+
+    /// @brief Enabled status setter
+    /// @param enabled: Boolean value representing the enabled status to set, a disabled cache always decodes the image.
+    void SetEnabled(bool enabled);
+
+    /// @brief Load an image
+    /// @details This method is responsible for returning the pixels of an image, from its cache file when valid, or
+    /// decoded from the image file otherwise, caching them meanwhile. Safe to call from several threads.
+    /// @param filePath: The path of the image file.
+    /// @return A surface owned by the caller, nullptr on failure.
+    SDL_Surface* Load(const std::string& filePath) const;
+
+    /// @brief Hash a sequence of bytes
+    /// @details 64 bits FNV-1a hash, used for the cache file names and the image content checks.
+    /// @return The hash value, continuing from the given seed.
+    static std::uint64_t Hash(const void* data, std::size_t size, std::uint64_t seed = 14695981039346656037ull);
+};
+
+#endif // IMAGECACHE_H //
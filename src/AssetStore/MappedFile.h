@@ -0,0 +1,57 @@
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <cstddef>
+#include <string>
+
+/// Class responsible for mapping a whole file in memory, read only.
+/// @details The pages are loaded by the operating system on first access, so opening a big file costs a single
+/// system call whatever its size.
+/// @file MappedFile.h
+/// @author Maxime Héliot
+/// @version 0.1.0 18/10/2026
+class MappedFile {
+private:
+    /// Pointer to the first byte of the mapped file, nullptr when nothing is mapped.
+    const unsigned char* data = nullptr;
+    /// Integer value representing the size of the mapped file, in bytes.
+    std::size_t size = 0;
+#ifdef _WIN32
+    /// Handle of the opened file.
+    void* fileHandle = nullptr;
+    /// Handle of the file mapping object.
+    void* mappingHandle = nullptr;
+#endif
+
+public:
+    /// @brief Default MappedFile constructor
+    /// @details Base constructor of the MappedFile class, mapping nothing.
+    MappedFile() = default;
+
+    /// @brief Default MappedFile destructor
+    /// @details Base destructor of the MappedFile class, unmapping the file.
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /// @brief Map a file
+    /// @details This method is responsible for mapping the given file in memory, unmapping the previous one.
+    /// @param filePath: The path of the file to map.
+    /// @return A boolean value representing the success status of the mapping.
+    bool Open(const std::string& filePath);
+
+    /// @brief Unmap the file
+    /// @details This method is responsible for releasing the mapping and the file.
+    void Close();
+
+    /// @brief Mapped data getter
+    /// @return A pointer to the first byte of the mapped file, nullptr when nothing is mapped.
+    const unsigned char* GetData() const;
+
+    /// @brief Mapped size getter
+    /// @return The size of the mapped file, in bytes.
+    std::size_t GetSize() const;
+};
+
+#endif // MAPPEDFILE_H //
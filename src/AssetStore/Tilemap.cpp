@@ -0,0 +1,137 @@
+#include "Tilemap.h"
+#include "MappedFile.h"
+#include <cstring>
+#include <limits>
+
+/// Highest tile id of a map, stored on 16 bits.
+static const std::uint32_t MAX_TILE_ID = std::numeric_limits<std::uint16_t>::max();
+
+bool Tilemap::LoadFromMemory(const unsigned char* data, std::size_t size) {
+    numRows = 0;
+    numCols = 0;
+    tiles.clear();
+    error.clear();
+
+    const bool isBinary = size >= sizeof(TILEMAP_BINARY_MAGIC) && std::memcmp(data, TILEMAP_BINARY_MAGIC, sizeof(TILEMAP_BINARY_MAGIC)) == 0;
+    const bool isLoaded = isBinary ? ParseBinary(data, size) : ParseText(reinterpret_cast<const char*>(data), size);
+    if (!isLoaded) {
+        numRows = 0;
+        numCols = 0;
+        tiles.clear();
+    }
+    return isLoaded;
+}
+
+bool Tilemap::LoadFromFile(const std::string& filePath) {
+    MappedFile file;
+    if (!file.Open(filePath)) {
+        error = "cannot open " + filePath;
+        return false;
+    }
+    return LoadFromMemory(file.GetData(), file.GetSize());
+}
+
+bool Tilemap::ParseText(const char* data, std::size_t size) {
+    // Two characters per tile at least, a digit and its separator
+    tiles.reserve(size / 2);
+
+    int rowNumCols = 0;
+    std::uint32_t tileId = 0;
+    bool hasDigits = false;
+    const char* const end = data + size;
+    for (const char* character = data; character <= end; character++) {
+        const char value = character < end ? *character : '\n';
+        if (value >= '0' && value <= '9') {
+            tileId = tileId * 10 + static_cast<std::uint32_t>(value - '0');
+            if (tileId > MAX_TILE_ID) {
+                error = "tile id too big at row " + std::to_string(numRows + 1);
+                return false;
+            }
+            hasDigits = true;
+        } else if (value == ',' || value == '\n') {
+            if (hasDigits) {
+                tiles.push_back(static_cast<std::uint16_t>(tileId));
+                rowNumCols++;
+            } else if (value == ',' || rowNumCols > 0) {
+                error = "missing tile id at row " + std::to_string(numRows + 1);
+                return false;
+            }
+            tileId = 0;
+            hasDigits = false;
+
+            // Blank lines, such as the one ending the file, are no rows
+            if (value == '\n' && rowNumCols > 0) {
+                if (numRows > 0 && rowNumCols != numCols) {
+                    error = "row " + std::to_string(numRows + 1) + " has " + std::to_string(rowNumCols) +
+                            " columns instead of " + std::to_string(numCols);
+                    return false;
+                }
+                numCols = rowNumCols;
+                numRows++;
+                rowNumCols = 0;
+            }
+        } else if (value != ' ' && value != '\t' && value != '\r') {
+            error = "unexpected character at row " + std::to_string(numRows + 1);
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Tilemap::ParseBinary(const unsigned char* data, std::size_t size) {
+    TilemapBinaryHeader header;
+    if (size < sizeof(header)) {
+        error = "truncated header";
+        return false;
+    }
+    std::memcpy(&header, data, sizeof(header));
+    if (header.version != TILEMAP_BINARY_VERSION) {
+        error = "unsupported version " + std::to_string(header.version);
+        return false;
+    }
+
+    const std::uint64_t numTiles = static_cast<std::uint64_t>(header.numRows) * header.numCols;
+    if (header.numRows > static_cast<std::uint32_t>(std::numeric_limits<int>::max()) ||
+        header.numCols > static_cast<std::uint32_t>(std::numeric_limits<int>::max()) ||
+        (size - sizeof(header)) / sizeof(std::uint16_t) < numTiles) {
+        error = "truncated tiles";
+        return false;
+    }
+    numRows = static_cast<int>(header.numRows);
+    numCols = static_cast<int>(header.numCols);
+    tiles.resize(numTiles);
+    std::memcpy(tiles.data(), data + sizeof(header), numTiles * sizeof(std::uint16_t));
+    return true;
+}
+
+void Tilemap::WriteBinary(std::vector<unsigned char>& buffer) const {
+    TilemapBinaryHeader header;
+    std::memcpy(header.magic, TILEMAP_BINARY_MAGIC, sizeof(header.magic));
+    header.version = TILEMAP_BINARY_VERSION;
+    header.numRows = static_cast<std::uint32_t>(numRows);
+    header.numCols = static_cast<std::uint32_t>(numCols);
+
+    buffer.resize(sizeof(header) + tiles.size() * sizeof(std::uint16_t));
+    std::memcpy(buffer.data(), &header, sizeof(header));
+    std::memcpy(buffer.data() + sizeof(header), tiles.data(), tiles.size() * sizeof(std::uint16_t));
+}
+
+bool Tilemap::HasSize(int expectedNumRows, int expectedNumCols) const {
+    return numRows == expectedNumRows && numCols == expectedNumCols;
+}
+
+int Tilemap::GetNumRows() const {
+    return numRows;
+}
+
+int Tilemap::GetNumCols() const {
+    return numCols;
+}
+
+std::uint16_t Tilemap::GetTile(int x, int y) const {
+    return tiles[static_cast<std::size_t>(y) * numCols + x];
+}
+
+const std::string& Tilemap::GetError() const {
+    return error;
+}
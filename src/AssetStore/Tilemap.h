@@ -0,0 +1,87 @@
+#ifndef TILEMAP_H
+#define TILEMAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/// Magic number opening every binary tilemap file.
+const char TILEMAP_BINARY_MAGIC[4] = {'P', 'C', 'T', 'M'};
+/// Version of the binary tilemap layout.
+const std::uint32_t TILEMAP_BINARY_VERSION = 1;
+
+/// Structure opening a binary tilemap file (.tmb), followed by the row major uint16 tile ids.
+struct TilemapBinaryHeader {
+    /// Magic number of the file, "PCTM".
+    char magic[4];
+    /// Integer value representing the version of the binary tilemap layout.
+    std::uint32_t version;
+    /// Integer value representing the number of rows of the map.
+    std::uint32_t numRows;
+    /// Integer value representing the number of columns of the map.
+    std::uint32_t numCols;
+};
+
+/// Class responsible for holding the tile ids of a map, as a packed row major array.
+/// @details Maps are read either from the text format, one comma separated line of tile ids per row, or from the
+/// binary format, a header followed by the tile ids as they are kept in memory. Both are told apart by the magic
+/// number, so a map file can be swapped for its binary version without changing the level script.
+/// @file Tilemap.h
+/// @author Maxime Héliot
+/// @version 0.1.0 18/10/2026
+class Tilemap {
+private:
+    /// Integer value representing the number of rows of the map.
+    int numRows = 0;
+    /// Integer value representing the number of columns of the map.
+    int numCols = 0;
+    /// Vector of the tile ids of the map.
+    /// @details tiles[index = row * numCols + column]
+    std::vector<std::uint16_t> tiles;
+    /// String object describing the last load failure.
+    std::string error;
+
+    /// @brief Parse the text format
+    /// @return A boolean value representing the success status of the parsing.
+    bool ParseText(const char* data, std::size_t size);
+
+    /// @brief Parse the binary format
+    /// @return A boolean value representing the success status of the parsing.
+    bool ParseBinary(const unsigned char* data, std::size_t size);
+
+public:
+    /// @brief Load a map from memory
+    /// @details This method is responsible for parsing a map held in memory, in any of the two formats.
+    /// @return A boolean value representing the success status of the load, see GetError otherwise.
+    bool LoadFromMemory(const unsigned char* data, std::size_t size);
+
+    /// @brief Load a map file
+    /// @details This method is responsible for mapping the given file in memory and parsing it, in any of the two formats.
+    /// @return A boolean value representing the success status of the load, see GetError otherwise.
+    bool LoadFromFile(const std::string& filePath);
+
+    /// @brief Write the map in the binary format
+    /// @param buffer: Vector receiving the bytes of the binary map.
+    void WriteBinary(std::vector<unsigned char>& buffer) const;
+
+    /// @brief Check the map dimensions
+    /// @return A boolean value representing the match between the map and the given dimensions.
+    bool HasSize(int expectedNumRows, int expectedNumCols) const;
+
+    /// @brief Number of rows getter
+    int GetNumRows() const;
+
+    /// @brief Number of columns getter
+    int GetNumCols() const;
+
+    /// @brief Tile id getter
+    /// @return The id of the tile at the given column (x) and row (y).
+    std::uint16_t GetTile(int x, int y) const;
+
+    /// @brief Last error getter
+    /// @return The description of the last load failure.
+    const std::string& GetError() const;
+};
+
+#endif // TILEMAP_H //
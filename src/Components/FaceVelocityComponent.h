@@ -0,0 +1,21 @@
+#ifndef FACEVELOCITYCOMPONENT_H
+#define FACEVELOCITYCOMPONENT_H
+
+/// Structure responsible for holding how an entity turns to face the direction it moves in.
+/// @details A rotation of 0 degrees faces up, 90 degrees faces right.
+/// @file FaceVelocityComponent.h
+/// @author Maxime Héliot
+/// @version 0.1.0 18/10/2026
+struct FaceVelocityComponent {
+    /// Double value representing the angle added to the direction of travel, in degrees, for sprites not facing up.
+    double angleOffset;
+    /// Boolean value representing the turn of the projectile emitter of the entity along with it.
+    bool isAimingProjectiles;
+
+    /// @brief Default FaceVelocityComponent constructor
+    /// @details Base constructor of the FaceVelocityComponent class taking the angle offset and aiming status as parameters.
+    FaceVelocityComponent(double angleOffset = 0.0, bool isAimingProjectiles = false):
+        angleOffset(angleOffset), isAimingProjectiles(isAimingProjectiles) {}
+};
+
+#endif // FACEVELOCITYCOMPONENT_H //
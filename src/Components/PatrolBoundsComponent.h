@@ -0,0 +1,23 @@
+#ifndef PATROLBOUNDSCOMPONENT_H
+#define PATROLBOUNDSCOMPONENT_H
+
+#include <glm/glm.hpp>
+
+/// Structure responsible for holding the area an entity patrols, turning back at its edges.
+/// @details The area is the map, shrunk by the margins, the far margins usually covering the size of the entity.
+/// @file PatrolBoundsComponent.h
+/// @author Maxime Héliot
+/// @version 0.1.0 18/10/2026
+struct PatrolBoundsComponent {
+    /// Vector2 object representing the distance of the area to the left and top edges of the map.
+    glm::vec2 nearMargin;
+    /// Vector2 object representing the distance of the area to the right and bottom edges of the map.
+    glm::vec2 farMargin;
+
+    /// @brief Default PatrolBoundsComponent constructor
+    /// @details Base constructor of the PatrolBoundsComponent class taking the margins to the map edges as parameters.
+    PatrolBoundsComponent(glm::vec2 nearMargin = glm::vec2(0.0), glm::vec2 farMargin = glm::vec2(0.0)):
+        nearMargin(nearMargin), farMargin(farMargin) {}
+};
+
+#endif // PATROLBOUNDSCOMPONENT_H //
@@ -3,6 +3,7 @@
 
 #include <SDL.h>
 #include <glm/glm.hpp>
+#include <string>
 
 /// Structure responsible for holding the data linked to the projectile emitter of an entity.
 /// @file ProjectileEmitterComponent.h
@@ -21,14 +22,19 @@ struct ProjectileEmitterComponent {
     bool isFriendly;
     /// Integer value representing the time since the last tick, in milliseconds, of the last projectile emission of the emitter.
     int lastEmissionTime;
+    /// String object representing the id of the sound asset played on every shot, empty for silent shots.
+    std::string soundAssetId;
+    /// Integer value representing the priority of the shot sound, higher priorities steal the voices of the lower ones.
+    int soundPriority;
 
     /// @brief Default ProjectileEmitterComponent constructor
     /// @details Base constructor of the ProjectileEmitterComponent class taking base values for the different class attributes as parameters.
     ProjectileEmitterComponent(glm::vec2 projectileVelocity = glm::vec2(0), int repeatFrequency = 0,
-                               int projectileDuration = 10000, int hitPercentDamage = 10, bool isFriendly = false):
+                               int projectileDuration = 10000, int hitPercentDamage = 10, bool isFriendly = false,
+                               std::string soundAssetId = "", int soundPriority = 1):
                                projectileVelocity(projectileVelocity), repeatFrequency(repeatFrequency),
                                projectileDuration(projectileDuration), hitPercentDamage(hitPercentDamage),
-                               isFriendly(isFriendly) {
+                               isFriendly(isFriendly), soundAssetId(soundAssetId), soundPriority(soundPriority) {
         this->lastEmissionTime = SDL_GetTicks();
     }
 };
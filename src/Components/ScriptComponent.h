@@ -2,14 +2,39 @@
 #define SCRIPTCOMPONENT_H
 
 #include <sol/sol.hpp>
+#include <cstdint>
 
 /// TODO: comments
 struct ScriptComponent {
     /// TODO: comments
     sol::function func;
+    /// Boolean value representing the call of the function once per update for every entity sharing it, with the
+    /// array of these entities, instead of once per entity.
+    bool isBatched;
+    /// Double value representing the time between two runs of the function, in seconds, 0 to run it every update.
+    double interval;
+    /// Boolean value representing the run of the function as a coroutine, able to wait through wait and wait_frames.
+    bool isCoroutine;
+    /// Boolean value representing a function only reading and writing the components of its entity, run in parallel
+    /// on the worker Lua states when neither batched, on interval nor a coroutine.
+    bool isPure;
+    /// Integer value representing the index of the entity in the Level table, where the worker Lua states fetch the
+    /// pure function from, -1 if unknown.
+    int levelEntityIndex;
+    /// Lua thread the coroutine runs on, for the coroutine scripts only.
+    sol::thread thread;
+    /// Coroutine of the function, resumed from where it waited, nil until started and once finished.
+    sol::coroutine coroutine;
+    /// Integer value representing the timer wheel entry of the script, 0 if the script runs every update.
+    unsigned int ticket = 0;
+    /// Integer value representing the script system update the function last ran at.
+    std::uint64_t lastRunTick = 0;
 
     /// TODO: comments
-    ScriptComponent(sol::function func = sol::lua_nil): func(func) {}
+    ScriptComponent(sol::function func = sol::lua_nil, bool isBatched = false, double interval = 0.0, bool isCoroutine = false,
+                    bool isPure = false, int levelEntityIndex = -1):
+                    func(func), isBatched(isBatched), interval(interval), isCoroutine(isCoroutine), isPure(isPure),
+                    levelEntityIndex(levelEntityIndex) {}
 };
 
 #endif // SCRIPTCOMPONENT_H //
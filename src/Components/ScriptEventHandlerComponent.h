@@ -0,0 +1,24 @@
+#ifndef SCRIPTEVENTHANDLERCOMPONENT_H
+#define SCRIPTEVENTHANDLERCOMPONENT_H
+
+#include <sol/sol.hpp>
+
+/// Structure responsible for holding the Lua functions an entity reacts to its events with.
+/// @file ScriptEventHandlerComponent.h
+/// @author Maxime Héliot
+/// @version 0.1.0 18/10/2026
+struct ScriptEventHandlerComponent {
+    /// Lua function called with the entities that collided during the update: function(entities, others, count).
+    sol::function onCollision;
+    /// Lua function called with the entities killed during the update: function(entities, count).
+    sol::function onKilled;
+    /// Boolean value representing the notification of the kill of the entity, so that it is notified only once.
+    bool isKillNotified;
+
+    /// @brief Default ScriptEventHandlerComponent constructor
+    /// @details Base constructor of the ScriptEventHandlerComponent class taking the handlers as parameters, nil for none.
+    ScriptEventHandlerComponent(sol::function onCollision = sol::lua_nil, sol::function onKilled = sol::lua_nil):
+        onCollision(onCollision), onKilled(onKilled), isKillNotified(false) {}
+};
+
+#endif // SCRIPTEVENTHANDLERCOMPONENT_H //
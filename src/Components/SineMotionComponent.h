@@ -0,0 +1,34 @@
+#ifndef SINEMOTIONCOMPONENT_H
+#define SINEMOTIONCOMPONENT_H
+
+#include <glm/glm.hpp>
+
+/// Structure responsible for holding the data of a wave or circular flight, moving the entity along
+/// position = origin + velocity * t + amplitude * sin(frequency * t + phase), axis by axis.
+/// @file SineMotionComponent.h
+/// @author Maxime Héliot
+/// @version 0.1.0 18/10/2026
+struct SineMotionComponent {
+    /// Vector2 object representing the position of the entity at the start of the motion, waves aside.
+    glm::vec2 origin;
+    /// Vector2 object representing the drift of the motion, in pixels per second.
+    glm::vec2 velocity;
+    /// Vector2 object representing the amplitude of the waves, in pixels.
+    glm::vec2 amplitude;
+    /// Vector2 object representing the angular frequency of the waves, in radians per second.
+    glm::vec2 frequency;
+    /// Vector2 object representing the phase of the waves at the start of the motion, in radians.
+    glm::vec2 phase;
+    /// Double value representing the time elapsed since the start of the motion, in seconds.
+    double time;
+
+    /// @brief Default SineMotionComponent constructor
+    /// @details Base constructor of the SineMotionComponent class taking the parameters of the motion as parameters.
+    SineMotionComponent(glm::vec2 origin = glm::vec2(0.0), glm::vec2 velocity = glm::vec2(0.0),
+                        glm::vec2 amplitude = glm::vec2(0.0), glm::vec2 frequency = glm::vec2(0.0),
+                        glm::vec2 phase = glm::vec2(0.0)):
+                        origin(origin), velocity(velocity), amplitude(amplitude), frequency(frequency), phase(phase),
+                        time(0.0) {}
+};
+
+#endif // SINEMOTIONCOMPONENT_H //
@@ -0,0 +1,24 @@
+#ifndef SOUNDEMITTERCOMPONENT_H
+#define SOUNDEMITTERCOMPONENT_H
+
+#include <string>
+
+/// Structure responsible for holding the data linked to the looping sound following an entity.
+/// @file SoundEmitterComponent.h
+/// @author Maxime Héliot
+/// @version 0.1.0 18/10/2026
+struct SoundEmitterComponent {
+    /// String object representing the id of the sound asset to loop.
+    std::string assetId;
+    /// Integer value representing the priority of the sound, higher priorities steal the voices of the lower ones.
+    int priority;
+    /// Integer value representing the volume of the sound next to the camera, from 0 to 128.
+    int volume;
+
+    /// @brief Default SoundEmitterComponent constructor
+    /// @details Base constructor of the SoundEmitterComponent class taking base values for the different class attributes as parameters.
+    SoundEmitterComponent(std::string assetId = "", int priority = 1, int volume = 128): assetId(assetId),
+                          priority(priority), volume(volume) {}
+};
+
+#endif // SOUNDEMITTERCOMPONENT_H //
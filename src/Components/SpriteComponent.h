@@ -1,6 +1,7 @@
 #ifndef SPRITECOMPONENT_H
 #define SPRITECOMPONENT_H
 
+#include <SDL.h>
 #include <string>
 
 /// Structure responsible for holding the data linked to the sprite rendering of an entity.
@@ -0,0 +1,22 @@
+#ifndef STREAMEDCOMPONENT_H
+#define STREAMEDCOMPONENT_H
+
+/// Structure responsible for holding the data linking an entity to the world chunk it was streamed in with.
+/// @file StreamedComponent.h
+/// @author Maxime Héliot
+/// @version 0.1.0 18/10/2026
+struct StreamedComponent {
+    /// Integer value representing the index of the chunk the entity belongs to.
+    int chunkIndex;
+    /// Integer value representing the index of the entity description the entity was created from, -1 for the tiles.
+    int descriptionIndex;
+    /// Boolean value representing the removal of the entity by the streamer, as opposed to a destruction in game.
+    bool isUnloading;
+
+    /// @brief Default StreamedComponent constructor
+    /// @details Base constructor of the StreamedComponent class taking the chunk and description indices as parameters.
+    StreamedComponent(int chunkIndex = 0, int descriptionIndex = -1):
+        chunkIndex(chunkIndex), descriptionIndex(descriptionIndex), isUnloading(false) {}
+};
+
+#endif // STREAMEDCOMPONENT_H //
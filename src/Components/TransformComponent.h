@@ -14,13 +14,26 @@ struct TransformComponent {
     glm::vec2 scale;
     /// Vector2 object representing the rotation values of the entity around the different world axes.
     glm::vec2 rotation;
+    /// Vector2 object representing the position values of the entity at the previous simulation tick.
+    glm::vec2 previousPosition;
+    /// Boolean value representing a change of the position or the scale not yet seen by the visibility index.
+    /// @details Set by the systems and the script bindings moving the entity, cleared by the VisibilitySystem.
+    bool isDirty;
 
     /// @brief Default TransformComponent constructor
     /// @details Base constructor of the TransformComponent class taking base values for the different class attributes as parameters.
     TransformComponent(glm::vec2 position = glm::vec2(0.0, 0.0),
                        glm::vec2 scale = glm::vec2(1.0, 1.0),
                        glm::vec2 rotation = glm::vec2(0.0, 0.0)) :
-                       position(position), scale(scale), rotation(rotation) {}
+                       position(position), scale(scale), rotation(rotation), previousPosition(position), isDirty(true) {}
+
+    /// @brief Interpolated position getter
+    /// @details This method is responsible for computing the position between the previous and the current tick.
+    /// @param alpha: Double value between 0 and 1 representing the progress towards the current tick.
+    /// @return Vector2 object representing the interpolated position of the entity.
+    glm::vec2 GetInterpolatedPosition(double alpha) const {
+        return previousPosition + (position - previousPosition) * static_cast<float>(alpha);
+    }
 };
 
 #endif // TRANSFORMCOMPONENT_H //
\ No newline at end of file
@@ -0,0 +1,64 @@
+#include "JobSystem.h"
+#include <algorithm>
+
+JobSystem::JobSystem(unsigned int numWorkers) {
+    if (numWorkers == 0) {
+        numWorkers = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+    }
+    for (unsigned int i = 0; i < numWorkers; i++) {
+        workers.emplace_back(&JobSystem::WorkerLoop, this);
+    }
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(jobsMutex);
+        isStopping = true;
+    }
+    jobAvailable.notify_all();
+    for (auto& worker: workers) {
+        worker.join();
+    }
+}
+
+void JobSystem::Submit(std::function<void()> job) {
+    {
+        std::lock_guard<std::mutex> lock(jobsMutex);
+        jobs.push_back(std::move(job));
+    }
+    jobAvailable.notify_one();
+}
+
+void JobSystem::Wait() {
+    std::unique_lock<std::mutex> lock(jobsMutex);
+    jobsDone.wait(lock, [this]() { return jobs.empty() && numRunningJobs == 0; });
+}
+
+unsigned int JobSystem::GetNumWorkers() const {
+    return static_cast<unsigned int>(workers.size());
+}
+
+void JobSystem::WorkerLoop() {
+    std::unique_lock<std::mutex> lock(jobsMutex);
+    while (true) {
+        jobAvailable.wait(lock, [this]() { return isStopping || !jobs.empty(); });
+
+        // Drain the queue before stopping so that no submitted job is silently dropped
+        if (jobs.empty()) {
+            return;
+        }
+
+        auto job = std::move(jobs.front());
+        jobs.pop_front();
+        numRunningJobs++;
+
+        lock.unlock();
+        job();
+        lock.lock();
+
+        numRunningJobs--;
+        if (jobs.empty() && numRunningJobs == 0) {
+            jobsDone.notify_all();
+        }
+    }
+}
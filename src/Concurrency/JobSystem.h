@@ -0,0 +1,66 @@
+#ifndef JOBSYSTEM_H
+#define JOBSYSTEM_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// Class responsible for running independent jobs on a fixed pool of worker threads.
+/// @details Jobs are taken in submission order from a single queue guarded by a mutex. They must not touch the
+/// renderer nor any other main thread only resource.
+/// @file JobSystem.h
+/// @author Maxime Héliot
+/// @version 0.1.0 18/10/2026
+class JobSystem {
+private:
+    /// Vector of the worker threads of the pool.
+    std::vector<std::thread> workers;
+    /// Deque of the jobs waiting for a worker.
+    std::deque<std::function<void()>> jobs;
+    /// Mutex guarding the job queue and the counters below.
+    std::mutex jobsMutex;
+    /// Condition variable woken up when a job is queued or when the pool stops.
+    std::condition_variable jobAvailable;
+    /// Condition variable woken up when the last running job of the pool completes.
+    std::condition_variable jobsDone;
+    /// Integer value representing the number of jobs currently being run by a worker.
+    int numRunningJobs = 0;
+    /// Boolean value representing the stopping status of the pool.
+    bool isStopping = false;
+
+public:
+    /// @brief Default JobSystem constructor
+    /// @details Base constructor of the JobSystem class, starting the worker threads.
+    /// @param numWorkers: The number of worker threads, zero to keep one hardware thread free for the main thread.
+    explicit JobSystem(unsigned int numWorkers = 0);
+
+    /// @brief Default JobSystem destructor
+    /// @details Base destructor of the JobSystem class, running the queued jobs to completion before joining the workers.
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    /// @brief Queue a job
+    /// @details This method is responsible for adding a job to the queue, it will be run by the first idle worker.
+    /// @param job: The function to run.
+    void Submit(std::function<void()> job);
+
+    /// @brief Wait for the jobs completion
+    /// @details This method is responsible for blocking the calling thread until the queue is empty and every worker is idle.
+    void Wait();
+
+    /// @brief Worker count getter
+    /// @return The number of worker threads of the pool.
+    unsigned int GetNumWorkers() const;
+
+private:
+    /// @brief Worker thread loop
+    /// @details This method is responsible for running queued jobs until the pool stops.
+    void WorkerLoop();
+};
+
+#endif // JOBSYSTEM_H //
@@ -0,0 +1,55 @@
+#ifndef SPSCQUEUE_H
+#define SPSCQUEUE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+/// Template class responsible for handing values over from exactly one producer thread to exactly one consumer thread.
+/// @details The queue is a fixed size ring buffer without any lock: the producer only writes the tail index and the
+/// consumer only writes the head index, so one slot is always kept empty to tell a full queue from an empty one.
+/// @file SpscQueue.h
+/// @author Maxime Héliot
+/// @version 0.1.0 18/10/2026
+template <typename T, std::size_t Capacity>
+class SpscQueue {
+private:
+    /// Array of the values waiting in the queue.
+    std::array<T, Capacity> buffer;
+    /// Index of the next value to pop, only written by the consumer thread.
+    alignas(64) std::atomic<std::size_t> head{0};
+    /// Index of the next slot to push into, only written by the producer thread.
+    alignas(64) std::atomic<std::size_t> tail{0};
+
+public:
+    /// @brief Push a value in the queue
+    /// @details This method is responsible for adding a value at the end of the queue. Must only be called by the producer thread.
+    /// @param value: The value to add to the queue.
+    /// @return A boolean value representing the success status of the push, false when the queue is full.
+    bool Push(const T& value) {
+        const auto currentTail = tail.load(std::memory_order_relaxed);
+        const auto nextTail = (currentTail + 1) % Capacity;
+        if (nextTail == head.load(std::memory_order_acquire)) {
+            return false;
+        }
+        buffer[currentTail] = value;
+        tail.store(nextTail, std::memory_order_release);
+        return true;
+    }
+
+    /// @brief Pop a value from the queue
+    /// @details This method is responsible for removing the value at the front of the queue. Must only be called by the consumer thread.
+    /// @param value: Reference filled with the popped value.
+    /// @return A boolean value representing the success status of the pop, false when the queue is empty.
+    bool Pop(T& value) {
+        const auto currentHead = head.load(std::memory_order_relaxed);
+        if (currentHead == tail.load(std::memory_order_acquire)) {
+            return false;
+        }
+        value = buffer[currentHead];
+        head.store((currentHead + 1) % Capacity, std::memory_order_release);
+        return true;
+    }
+};
+
+#endif // SPSCQUEUE_H //
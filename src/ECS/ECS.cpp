@@ -39,13 +39,19 @@ bool Entity::BelongsToGroup(const std::string &group) const {
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 void System::AddEntityToSystem(Entity entity) {
     entities.push_back(entity);
+    OnEntityAdded(entity);
 }
 
 void System::RemoveEntityFromSystem(Entity entity) {
     // Modern C++ way to erase something in a vector.
-    entities.erase(std::remove_if(entities.begin(), entities.end(), [&entity](Entity other) {
+    auto removedEntities = std::remove_if(entities.begin(), entities.end(), [&entity](Entity other) {
         return entity == other;
-    }), entities.end());
+    });
+    if (removedEntities == entities.end()) {
+        return;
+    }
+    entities.erase(removedEntities, entities.end());
+    OnEntityRemoved(entity);
 }
 
 std::vector<Entity> System::GetSystemEntities() const {
@@ -86,6 +92,25 @@ void Registry::KillEntity(Entity entity) {
     entitiesToBeKilled.insert(entity);
 }
 
+void Registry::KillAllEntities() {
+    std::vector<bool> isFree(numEntities, false);
+    for (auto entityId: freeIds) {
+        isFree[entityId] = true;
+    }
+
+    for (int entityId = 0; entityId < numEntities; entityId++) {
+        if (!isFree[entityId]) {
+            Entity entity(entityId);
+            entity.registry = this;
+            KillEntity(entity);
+        }
+    }
+}
+
+const std::set<Entity>& Registry::GetEntitiesToBeKilled() const {
+    return entitiesToBeKilled;
+}
+
 void Registry::AddEntityToSystems(Entity entity) {
     const auto entityId = entity.GetId();
     const auto& entityComponentSignature = entityComponentSignatures[entityId];
@@ -155,6 +180,10 @@ Entity Registry::GetEntityByTag(const std::string &tag) const {
     return entityPerTag.at(tag);
 }
 
+const std::unordered_map<std::string, Entity>& Registry::GetTaggedEntities() const {
+    return entityPerTag;
+}
+
 void Registry::RemoveEntityTag(Entity entity) {
     auto taggedEntity = tagPerEntity.find(entity.GetId());
     if (taggedEntity != tagPerEntity.end()) {
@@ -183,6 +212,41 @@ std::vector<Entity> Registry::GetEntitiesByGroup(const std::string &group) const
     return std::vector<Entity>(setOfEntities.begin(), setOfEntities.end());
 }
 
+void Registry::GetEntitiesByGroup(const std::string& group, const Signature& signature, std::vector<Entity>& entities) const {
+    entities.clear();
+    auto groupEntities = entitiesPerGroup.find(group);
+    if (groupEntities == entitiesPerGroup.end()) {
+        return;
+    }
+    for (auto entity: groupEntities->second) {
+        if ((entityComponentSignatures[entity.GetId()] & signature) == signature) {
+            entities.push_back(entity);
+        }
+    }
+}
+
+void Registry::GetEntitiesWithSignature(const Signature& signature, std::vector<Entity>& entities) {
+    entities.clear();
+    if (signature.none()) {
+        return;
+    }
+    // The signatures of the killed entities are reset, only the living ones can match
+    for (int entityId = 0; entityId < numEntities; entityId++) {
+        if ((entityComponentSignatures[entityId] & signature) == signature) {
+            Entity entity(entityId);
+            entity.registry = this;
+            entities.push_back(entity);
+        }
+    }
+}
+
+Signature Registry::GetEntitySignature(int entityId) const {
+    if (entityId < 0 || entityId >= static_cast<int>(entityComponentSignatures.size())) {
+        return Signature();
+    }
+    return entityComponentSignatures[entityId];
+}
+
 void Registry::RemoveEntityGroup(Entity entity) {
     // If in group, remove entity from group management
     auto groupedEntity = groupPerEntity.find(entity.GetId());
@@ -148,7 +148,7 @@ public:
 
     /// @brief Default destructor
     /// @details A default destructor of the System class.
-    ~System() = default;
+    virtual ~System() = default;
 
     /// @brief Add an entity to the system
     /// @details This method is responsible to add an entity object to the list of ones to consider by the system object.
@@ -174,6 +174,18 @@ public:
     /// @details This method is responsible to set the entity required component to be considered by the system.
     template <typename TComponent>
     void RequireComponent();
+
+protected:
+    /// @brief Entity added hook
+    /// @details This method is called once an entity joined the list of ones considered by the system.
+    /// @param entity: The Entity object added to the system.
+    virtual void OnEntityAdded(Entity entity) {}
+
+    /// @brief Entity removed hook
+    /// @details This method is called once an entity left the list of ones considered by the system, its components
+    /// still being reachable.
+    /// @param entity: The Entity object removed from the system.
+    virtual void OnEntityRemoved(Entity entity) {}
 };
 
 /// Interface of the Pool<T> class.
@@ -380,6 +392,15 @@ public:
     /// @param entity: The Entity object to remove from the system.
     void KillEntity(Entity entity);
 
+    /// @brief Remove all entities method
+    /// @details This method is responsible to kill every living entity, the removal happening in the next Registry update cycle.
+    void KillAllEntities();
+
+    /// @brief Get the entities to be killed
+    /// @details This method is responsible to get the entities killed since the last Registry update cycle, still alive until the next one.
+    /// @return Set of the entities awaiting destruction.
+    const std::set<Entity>& GetEntitiesToBeKilled() const;
+
     /// @brief Add entity to systems method
     /// @details This method is responsible for subscribing entity to the different systems that could be interested, regarding the entity components signature.
     /// @param entity: The Entity class object to add to the different systems of the registry.
@@ -410,6 +431,11 @@ public:
     /// @return Entity object associate to the given tag.
     Entity GetEntityByTag(const std::string& tag) const;
 
+    /// @brief Get tagged entities
+    /// @details This method is responsible to get every tagged entity.
+    /// @return Map of the tagged entities associated by tag.
+    const std::unordered_map<std::string, Entity>& GetTaggedEntities() const;
+
     /// @brief Remove the entity tag
     /// @details This method is responsible to remove the tag associate to the given entity.
     /// @param entity: Entity object to remove the tag from.
@@ -434,6 +460,24 @@ public:
     /// @return Vector of entity objects associate to the given group.
     std::vector<Entity> GetEntitiesByGroup(const std::string& group) const;
 
+    /// @brief Get entities by group and components
+    /// @details This method is responsible to fill the given vector with the entities of the given group having every component of the given signature.
+    /// @param group: String group associate to entities, unknown groups having no entity.
+    /// @param signature: Signature object representing the components the entities need, none to get the whole group.
+    /// @param entities: Vector of entity objects to fill, cleared first.
+    void GetEntitiesByGroup(const std::string& group, const Signature& signature, std::vector<Entity>& entities) const;
+
+    /// @brief Get entities by components
+    /// @details This method is responsible to fill the given vector with the living entities having every component of the given signature.
+    /// @param signature: Signature object representing the components the entities need, at least one.
+    /// @param entities: Vector of entity objects to fill, cleared first.
+    void GetEntitiesWithSignature(const Signature& signature, std::vector<Entity>& entities);
+
+    /// @brief Get the components signature of an entity
+    /// @param entityId: Integer value representing the id of the entity.
+    /// @return Signature object representing the components of the entity, none for an unknown or killed entity.
+    Signature GetEntitySignature(int entityId) const;
+
     /// @brief Remove the entity group
     /// @details This method is responsible to remove the group associate to the given entity.
     /// @param entity: Entity object to remove the group from.
@@ -0,0 +1,27 @@
+#ifndef PLAYSOUNDEVENT_H
+#define PLAYSOUNDEVENT_H
+
+#include "../EventBus/Event.h"
+#include <glm/glm.hpp>
+#include <string>
+
+/// Class responsible of handling all the one shot sound playing requests.
+/// @file PlaySoundEvent.h
+/// @author Maxime Héliot
+/// @version 0.1.0 18/10/2026
+class PlaySoundEvent: public Event {
+public:
+    /// String object representing the id of the sound asset to play.
+    std::string assetId;
+    /// Vector object representing the world position the sound is played at.
+    glm::vec2 position;
+    /// Integer value representing the priority of the sound, higher priorities steal the voices of the lower ones.
+    int priority;
+
+    /// @brief Default PlaySoundEvent constructor
+    /// @details Base constructor of the PlaySoundEvent class taking base values for the different class attributes as parameters.
+    PlaySoundEvent(std::string assetId, glm::vec2 position, int priority = 1): assetId(std::move(assetId)),
+                   position(position), priority(priority) {}
+};
+
+#endif // PLAYSOUNDEVENT_H //
@@ -0,0 +1,139 @@
+#include "FileWatcher.h"
+#include "../Logger/Logger.h"
+#include <algorithm>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+/// Time between two scans of the tree when polling.
+static const std::chrono::milliseconds SCAN_INTERVAL(500);
+
+FileWatcher::~FileWatcher() {
+    Stop();
+}
+
+bool FileWatcher::Start(const std::string& directory) {
+    Stop();
+    std::error_code error;
+    if (!fs::is_directory(directory, error)) {
+        Logger::Err("Cannot watch the missing directory " + directory);
+        return false;
+    }
+    rootDirectory = directory;
+
+#ifdef __linux__
+    inotifyDescriptor = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotifyDescriptor >= 0) {
+        WatchDirectory(rootDirectory);
+        Logger::Log("Watching " + rootDirectory + " with inotify");
+        return true;
+    }
+#endif
+
+    // Record the current state of the tree, only the later writes are changes
+    Scan(nullptr);
+    lastScanTime = std::chrono::steady_clock::now();
+    Logger::Log("Watching " + rootDirectory + " by polling");
+    return true;
+}
+
+void FileWatcher::Stop() {
+#ifdef __linux__
+    if (inotifyDescriptor >= 0) {
+        close(inotifyDescriptor);
+    }
+#endif
+    inotifyDescriptor = -1;
+    watchedDirectories.clear();
+    modificationTimes.clear();
+    rootDirectory.clear();
+}
+
+void FileWatcher::WatchDirectory(const std::string& directory) {
+#ifdef __linux__
+    const int watchDescriptor = inotify_add_watch(inotifyDescriptor, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+    if (watchDescriptor < 0) {
+        return;
+    }
+    watchedDirectories[watchDescriptor] = directory;
+
+    std::error_code error;
+    for (const auto& entry: fs::directory_iterator(directory, error)) {
+        if (entry.is_directory(error)) {
+            WatchDirectory(entry.path().generic_string());
+        }
+    }
+#endif
+}
+
+void FileWatcher::Scan(std::vector<std::string>* changedFiles) {
+    std::error_code error;
+    for (auto entry = fs::recursive_directory_iterator(rootDirectory, error); !error && entry != fs::recursive_directory_iterator(); entry.increment(error)) {
+        if (!entry->is_regular_file(error)) {
+            continue;
+        }
+        const std::string filePath = entry->path().generic_string();
+        const auto modificationTime = entry->last_write_time(error);
+        auto knownTime = modificationTimes.find(filePath);
+        if (knownTime == modificationTimes.end() || knownTime->second != modificationTime) {
+            if (changedFiles && knownTime != modificationTimes.end()) {
+                changedFiles->push_back(filePath);
+            }
+            modificationTimes[filePath] = modificationTime;
+        }
+    }
+}
+
+void FileWatcher::Poll(std::vector<std::string>& changedFiles) {
+    if (rootDirectory.empty()) {
+        return;
+    }
+    const std::size_t firstChange = changedFiles.size();
+
+#ifdef __linux__
+    if (inotifyDescriptor >= 0) {
+        alignas(inotify_event) char buffer[4096];
+        while (true) {
+            const ssize_t length = read(inotifyDescriptor, buffer, sizeof(buffer));
+            if (length <= 0) {
+                break;
+            }
+            for (ssize_t offset = 0; offset < length;) {
+                const auto* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+                offset += sizeof(inotify_event) + event->len;
+
+                auto directory = watchedDirectories.find(event->wd);
+                if (directory == watchedDirectories.end() || event->len == 0) {
+                    continue;
+                }
+                const std::string filePath = directory->second + "/" + event->name;
+                if (event->mask & IN_ISDIR) {
+                    // Follow the directories created after the start
+                    if (event->mask & IN_CREATE) {
+                        WatchDirectory(filePath);
+                    }
+                } else if (event->mask & (IN_CLOSE_WRITE | IN_MOVED_TO)) {
+                    changedFiles.push_back(filePath);
+                }
+            }
+        }
+    }
+#endif
+
+    if (inotifyDescriptor < 0) {
+        const auto now = std::chrono::steady_clock::now();
+        if (now - lastScanTime < SCAN_INTERVAL) {
+            return;
+        }
+        lastScanTime = now;
+        Scan(&changedFiles);
+    }
+
+    // Editors often write a file several times in a row, report it once
+    std::sort(changedFiles.begin() + firstChange, changedFiles.end());
+    changedFiles.erase(std::unique(changedFiles.begin() + firstChange, changedFiles.end()), changedFiles.end());
+}
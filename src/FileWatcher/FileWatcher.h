@@ -0,0 +1,65 @@
+#ifndef FILEWATCHER_H
+#define FILEWATCHER_H
+
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/// Class responsible for reporting the files written under a directory tree.
+/// @details On Linux the changes come from inotify and cost nothing until a file is written. Elsewhere, or if
+/// inotify is not available, the tree is scanned for new modification times a couple of times per second.
+/// @file FileWatcher.h
+/// @author Maxime Héliot
+/// @version 0.1.0 18/10/2026
+class FileWatcher {
+private:
+    /// String object representing the root directory of the watched tree.
+    std::string rootDirectory;
+    /// Integer value representing the inotify instance descriptor, -1 when polling.
+    int inotifyDescriptor = -1;
+    /// Map of the watched directory paths by inotify watch descriptor.
+    std::unordered_map<int, std::string> watchedDirectories;
+    /// Map of the last known modification time of every file of the tree, used when polling.
+    std::unordered_map<std::string, std::filesystem::file_time_type> modificationTimes;
+    /// Time point of the last scan of the tree, used when polling.
+    std::chrono::steady_clock::time_point lastScanTime;
+
+    /// @brief Watch a directory
+    /// @details This method is responsible for adding an inotify watch on the given directory and its sub directories.
+    void WatchDirectory(const std::string& directory);
+
+    /// @brief Scan the tree
+    /// @details This method is responsible for recording the modification time of every file of the tree.
+    /// @param changedFiles: Vector receiving the files whose modification time changed since the last scan, may be nullptr.
+    void Scan(std::vector<std::string>* changedFiles);
+
+public:
+    /// @brief Default FileWatcher constructor
+    /// @details Base constructor of the FileWatcher class, watching nothing.
+    FileWatcher() = default;
+
+    /// @brief Default FileWatcher destructor
+    /// @details Base destructor of the FileWatcher class, stopping the watch.
+    ~FileWatcher();
+
+    FileWatcher(const FileWatcher&) = delete;
+    FileWatcher& operator=(const FileWatcher&) = delete;
+
+    /// @brief Start watching a directory tree
+    /// @param directory: The root directory of the tree to watch.
+    /// @return A boolean value representing the success status of the start.
+    bool Start(const std::string& directory);
+
+    /// @brief Stop watching
+    void Stop();
+
+    /// @brief Collect the changed files
+    /// @details This method is responsible for returning, without blocking, the files written since the last call.
+    /// Each file is reported once per call, however many times it was written meanwhile.
+    /// @param changedFiles: Vector receiving the paths of the changed files, prefixed by the root directory.
+    void Poll(std::vector<std::string>& changedFiles);
+};
+
+#endif // FILEWATCHER_H //
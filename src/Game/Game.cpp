@@ -12,27 +12,58 @@
 #include "../Systems/CameraMovementSystem.h"
 #include "../Systems/ProjectileLifeCycleSystem.h"
 #include "../Components/TextLabelComponent.h"
+#include "../Components/RigidBodyComponent.h"
+#include "../Components/HealthComponent.h"
 #include "../Systems/RenderTextSystem.h"
 #include "../Systems/RenderHealthBarSystem.h"
 #include "../Systems/RenderGUISystem.h"
 #include "./LevelLoader.h"
 #include "../Systems/ScriptSystem.h"
+#include "../Systems/ScriptEventSystem.h"
+#include "../Systems/VisibilitySystem.h"
+#include "../Systems/InterpolationSystem.h"
+#include "../Systems/AssetReferenceSystem.h"
+#include "../Systems/AudioSystem.h"
+#include "../Systems/StreamingSystem.h"
+#include "../Systems/SineMotionSystem.h"
+#include "../Systems/PatrolBoundsSystem.h"
+#include "../Systems/FaceVelocitySystem.h"
 #include <SDL.h>
 #include <SDL_image.h>
+#include <SDL_mixer.h>
 #include <glm/glm.hpp>
 #include <imgui/imgui.h>
 #include <imgui/imgui_sdl.h>
 #include <imgui/imgui_impl_sdl.h>
 #include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <chrono>
+#include <filesystem>
+#include <thread>
 
 int Game::windowWidth;
 int Game::windowHeight;
 int Game::mapWidth;
 int Game::mapHeight;
 
-Game::Game() {
+Game::Game(): lua(sol::default_at_panic, &LuaHeap::Allocate, &luaHeap) {
+    // The garbage collector runs in the idle time of the frames instead of in the middle of the scripts
+    luaHeap.TakeOverGarbageCollector(lua.lua_state());
+
     isRunning = false;
     isDebug = false;
+    isPipelined = false;
+    isHeadless = false;
+    numHeadlessTicks = 0;
+    levelNumber = 2;
+    isHotReloadEnabled = false;
+    isLevelReloadRequested = false;
+    isSimulationPauseRequested = false;
+    isSimulationPaused = false;
+    isWorldStreamed = false;
+    scriptProfilerSampleCount = 0;
+    isScriptProfilerToggleRequested = false;
     registry = std::make_unique<Registry>();
     assetStore = std::make_unique<AssetStore>();
     eventBus = std::make_unique<EventBus>();
@@ -44,7 +75,7 @@ Game::~Game() {
 }
 
 void Game::Initialize() {
-    if (SDL_Init(SDL_INIT_EVERYTHING) != 0)
+    if (SDL_Init(isHeadless ? SDL_INIT_TIMER | SDL_INIT_EVENTS : SDL_INIT_EVERYTHING) != 0)
     {
         Logger::Err("Error initializing SDL.");
         return;
@@ -55,6 +86,27 @@ void Game::Initialize() {
         return;
     }
 
+    // A fixed number of mixer channels, the audio system plays every sound on that pool of voices
+    if (!isHeadless) {
+        if (Mix_OpenAudio(44100, MIX_DEFAULT_FORMAT, 2, 1024) != 0) {
+            Logger::Err("Error initializing SDL mixer, the game runs without sound.");
+        } else {
+            Mix_AllocateChannels(NUM_AUDIO_VOICES);
+        }
+    }
+
+    if (isHeadless) {
+        // No window, renderer nor GUI: the camera covers a virtual screen so the camera dependent systems still work
+        window = nullptr;
+        renderer = nullptr;
+        windowWidth = HEADLESS_WINDOW_WIDTH;
+        windowHeight = HEADLESS_WINDOW_HEIGHT;
+        camera = {0, 0, windowWidth, windowHeight};
+        previousCamera = camera;
+        isRunning = true;
+        return;
+    }
+
     SDL_DisplayMode displayMode;
     // use reference to get the memory address of the struct
     // the method will populate the value inside the struct
@@ -90,6 +142,7 @@ void Game::Initialize() {
     camera.y = 0;
     camera.w = windowWidth;
     camera.h = windowHeight;
+    previousCamera = camera;
 
     isRunning = true;
 }
@@ -125,10 +178,53 @@ void Game::ProcessInput() {
                 {
                     isDebug = !isDebug;
                 }
-                eventBus->EmitEvent<KeyPressedEvent>(sdlEvent.key.keysym.sym);
+                if (sdlEvent.key.keysym.sym == SDLK_p)
+                {
+                    // The Lua state lives on the simulation thread, which toggles the profiler before its next tick
+                    isScriptProfilerToggleRequested = true;
+                }
+                if (isPipelined) {
+                    // The systems live on the simulation thread, hand the key over instead of emitting it from here
+                    pressedKeys.Push(sdlEvent.key.keysym.sym);
+                } else {
+                    eventBus->EmitEvent<KeyPressedEvent>(sdlEvent.key.keysym.sym);
+                }
                 break;
         }
     }
+
+    ProcessChangedAssets();
+}
+
+/// @brief Check whether two paths name the same existing file.
+static bool IsSameFile(const std::string& filePath, const std::string& otherFilePath) {
+    std::error_code error;
+    return std::filesystem::equivalent(filePath, otherFilePath, error) && !error;
+}
+
+void Game::ProcessChangedAssets() {
+    if (!fileWatcher) {
+        return;
+    }
+
+    std::vector<std::string> changedFiles;
+    fileWatcher->Poll(changedFiles);
+    for (const auto& filePath: changedFiles) {
+        const auto extensionPosition = filePath.rfind('.');
+        const std::string extension = extensionPosition != std::string::npos ? filePath.substr(extensionPosition) : "";
+        if (extension == ".png") {
+            assetStore->ReloadTextureFile(filePath);
+        } else if (extension == ".lua" || extension == ".map" || extension == ".tmb") {
+            // The scripts and tilemaps of the other levels are edited without touching the one being played
+            const bool isLevelFile = std::any_of(levelFiles.begin(), levelFiles.end(), [&filePath](const std::string& levelFile) {
+                return IsSameFile(filePath, levelFile);
+            });
+            if (isLevelFile) {
+                Logger::Log("Level file " + filePath + " changed");
+                isLevelReloadRequested = true;
+            }
+        }
+    }
 }
 
 void Game::Setup() {
@@ -147,29 +243,198 @@ void Game::Setup() {
     registry->AddSystem<RenderHealthBarSystem>();
     registry->AddSystem<RenderGUISystem>();
     registry->AddSystem<ScriptSystem>();
+    registry->AddSystem<ScriptEventSystem>();
+    registry->AddSystem<VisibilitySystem>();
+    registry->AddSystem<InterpolationSystem>();
+    registry->AddSystem<AssetReferenceSystem<SpriteComponent>>(*assetStore);
+    registry->AddSystem<AssetReferenceSystem<TextLabelComponent>>(*assetStore);
+    registry->AddSystem<AudioSystem>();
+    registry->AddSystem<StreamingSystem>();
+    registry->AddSystem<SineMotionSystem>();
+    registry->AddSystem<PatrolBoundsSystem>();
+    registry->AddSystem<FaceVelocitySystem>();
 
     // Create the bindings between C++ and Lua
-    registry->GetSystem<ScriptSystem>().CreateLuaBindings(lua);
+    registry->GetSystem<ScriptSystem>().CreateLuaBindings(lua, *registry);
+    registry->GetSystem<ScriptEventSystem>().SetLuaState(lua.lua_state());
+    if (scriptProfilerSampleCount > 0) {
+        registry->GetSystem<ScriptSystem>().GetProfiler().Enable(lua.lua_state(), scriptProfilerSampleCount);
+    }
+
+
+    if (isHotReloadEnabled) {
+        // The changes are made to the loose files, the archive would keep serving the packed ones
+        fileWatcher = std::make_unique<FileWatcher>();
+        if (!fileWatcher->Start("./../assets")) {
+            fileWatcher.reset();
+        }
+    } else {
+        // Prefer the packed assets when the archive was built
+        assetStore->MountArchive("./../assets.pcpk");
+    }
 
+    if (isWorldStreamed) {
+        worldStreamer = std::make_unique<WorldStreamer>();
+        registry->GetSystem<StreamingSystem>().SetWorldStreamer(worldStreamer.get());
+    }
 
     LevelLoader loader;
-    lua.open_libraries(sol::lib::base, sol::lib::math, sol::lib::os);
-    loader.LoadLevel(lua, registry, assetStore, renderer, 2);
+    lua.open_libraries(sol::lib::base, sol::lib::math, sol::lib::os, sol::lib::coroutine);
+    loader.LoadLevel(lua, registry, assetStore, renderer, levelNumber, worldStreamer.get());
+    levelFiles = loader.GetLevelFiles();
+    if (!registry->GetSystem<ScriptSystem>().SetLevel(levelNumber, loader.GetNumPureScripts())) {
+        Logger::Err("Error running the level script in the worker Lua states, the pure scripts run on the main one");
+    }
+
+    // Get rid of the garbage of the level script while loading, not in the first frames
+    luaHeap.CollectGarbage(lua.lua_state());
 }
 
-void Game::Update() {
-    // If we are too fast, waste some time cycle loops to reach the millisecs per frame value
-    int timeToWait = MILLISECS_PER_FRAME - (SDL_GetTicks() - millisecsPreviousFrame);
-    if (timeToWait > 0 && timeToWait <= MILLISECS_PER_FRAME)
-    {
-        SDL_Delay(timeToWait);
+/// Structure holding the state of a tagged entity carried over a level reload.
+struct TaggedEntityState {
+    /// String object representing the tag of the entity.
+    std::string tag;
+    /// Integer value representing the LevelComponentFlag bits of the components kept.
+    std::uint32_t components = 0;
+    /// TransformComponent object holding the position and rotation of the entity.
+    TransformComponent transform;
+    /// RigidBodyComponent object holding the velocity of the entity.
+    RigidBodyComponent rigidBody;
+    /// HealthComponent object holding the health of the entity.
+    HealthComponent health;
+};
+
+void Game::ReloadLevel() {
+    // Keep the state of the tagged entities, so the player goes on from the same spot, at the same speed and health
+    std::vector<TaggedEntityState> taggedStates;
+    for (const auto& taggedEntity: registry->GetTaggedEntities()) {
+        const Entity& entity = taggedEntity.second;
+        TaggedEntityState state;
+        state.tag = taggedEntity.first;
+        if (entity.HasComponent<TransformComponent>()) {
+            state.components |= LEVEL_COMPONENT_TRANSFORM;
+            state.transform = entity.GetComponent<TransformComponent>();
+        }
+        if (entity.HasComponent<RigidBodyComponent>()) {
+            state.components |= LEVEL_COMPONENT_RIGIDBODY;
+            state.rigidBody = entity.GetComponent<RigidBodyComponent>();
+        }
+        if (entity.HasComponent<HealthComponent>()) {
+            state.components |= LEVEL_COMPONENT_HEALTH;
+            state.health = entity.GetComponent<HealthComponent>();
+        }
+        taggedStates.push_back(state);
+    }
+
+    registry->KillAllEntities();
+    registry->Update();
+
+    LevelLoader loader;
+    loader.LoadLevel(lua, registry, assetStore, renderer, levelNumber, worldStreamer.get());
+    levelFiles = loader.GetLevelFiles();
+    if (!registry->GetSystem<ScriptSystem>().SetLevel(levelNumber, loader.GetNumPureScripts())) {
+        Logger::Err("Error running the level script in the worker Lua states, the pure scripts run on the main one");
+    }
+    luaHeap.CollectGarbage(lua.lua_state());
+
+    // The components of the reloaded script win, only the state changed by the game is written back
+    const auto& taggedEntities = registry->GetTaggedEntities();
+    for (const auto& taggedState: taggedStates) {
+        auto taggedEntity = taggedEntities.find(taggedState.tag);
+        if (taggedEntity == taggedEntities.end()) {
+            continue;
+        }
+        const Entity& entity = taggedEntity->second;
+        if ((taggedState.components & LEVEL_COMPONENT_TRANSFORM) && entity.HasComponent<TransformComponent>()) {
+            auto& transform = entity.GetComponent<TransformComponent>();
+            transform.position = taggedState.transform.position;
+            transform.rotation = taggedState.transform.rotation;
+            transform.previousPosition = transform.position;
+            transform.isDirty = true;
+        }
+        if ((taggedState.components & LEVEL_COMPONENT_RIGIDBODY) && entity.HasComponent<RigidBodyComponent>()) {
+            entity.GetComponent<RigidBodyComponent>().velocity = taggedState.rigidBody.velocity;
+        }
+        if ((taggedState.components & LEVEL_COMPONENT_HEALTH) && entity.HasComponent<HealthComponent>()) {
+            entity.GetComponent<HealthComponent>().healthPercentage = taggedState.health.healthPercentage;
+        }
+    }
+
+    // The time spent reloading is not simulated
+    previousFrameCounter = 0;
+    Logger::Log("Level " + std::to_string(levelNumber) + " reloaded");
+}
+
+void Game::ReloadLevelPipelined() {
+    // Wait for the simulation thread to finish its tick, handing it the snapshots back so that it never blocks
+    std::unique_lock<std::mutex> lock(simulationPauseMutex);
+    isSimulationPauseRequested = true;
+    RenderSnapshot* snapshot = nullptr;
+    while (!isSimulationPaused && isRunning) {
+        while (readySnapshots.Pop(snapshot)) {
+            freeSnapshots.Push(snapshot);
+        }
+        simulationPauseCondition.wait_for(lock, std::chrono::milliseconds(1));
+    }
+
+    // The snapshots extracted before the reload may refer to the textures it releases
+    while (readySnapshots.Pop(snapshot)) {
+        freeSnapshots.Push(snapshot);
+    }
+
+    // The paused flag only drops once the simulation thread saw the request cleared, under the same lock
+    if (isSimulationPaused) {
+        ReloadLevel();
+    }
+    isSimulationPauseRequested = false;
+    lock.unlock();
+    simulationPauseCondition.notify_all();
+}
+
+int Game::AdvanceSimulation() {
+    // In pipelined mode the render thread reloads the level, the simulation thread being paused
+    if (!isPipelined && isLevelReloadRequested.exchange(false)) {
+        ReloadLevel();
+    }
+    if (isScriptProfilerToggleRequested.exchange(false)) {
+        ToggleScriptProfiler();
+    }
+
+    const Uint64 currentFrameCounter = SDL_GetPerformanceCounter();
+    if (previousFrameCounter == 0) {
+        previousFrameCounter = currentFrameCounter;
+    }
+    tickAccumulator += static_cast<double>(currentFrameCounter - previousFrameCounter) / SDL_GetPerformanceFrequency();
+    previousFrameCounter = currentFrameCounter;
+
+    int numTicks = 0;
+    while (tickAccumulator >= SECONDS_PER_TICK && numTicks < MAX_TICKS_PER_FRAME) {
+        Update();
+        tickAccumulator -= SECONDS_PER_TICK;
+        numTicks++;
+    }
+
+    // Past the catch-up limit, drop the backlog instead of spiraling into ever longer frames
+    if (tickAccumulator >= SECONDS_PER_TICK) {
+        tickAccumulator = std::fmod(tickAccumulator, SECONDS_PER_TICK);
     }
 
-    // The difference in ticks since the last frame, converted to seconds.
-    double deltaTime = (SDL_GetTicks() - millisecsPreviousFrame) / 1000.0f;
+    interpolationAlpha = tickAccumulator / SECONDS_PER_TICK;
+    return numTicks;
+}
+
+void Game::StepLuaGarbageCollector() {
+    // Collect the Lua garbage in the time left before the next tick is due
+    luaHeap.StepGarbageCollector(lua.lua_state(), std::min(LUA_GC_FRAME_BUDGET, SECONDS_PER_TICK - tickAccumulator));
+}
+
+void Game::Update() {
+    // Every tick simulates the same amount of time
+    const double deltaTime = SECONDS_PER_TICK;
 
-    // Store the current frame time
-    millisecsPreviousFrame = SDL_GetTicks();
+    // Keep the state of the previous tick to interpolate the frames rendered in between
+    previousCamera = camera;
+    registry->GetSystem<InterpolationSystem>().Update();
 
     // Reset all event handlers for the current frame
     eventBus->Reset();
@@ -179,51 +444,244 @@ void Game::Update() {
     registry->GetSystem<KeyboardControlSystem>().SubscribeToEvents(eventBus);
     registry->GetSystem<ProjectileEmitSystem>().SubscribeToEvents(eventBus);
     registry->GetSystem<MovementSystem>().SubscribeToEvents(eventBus);
+    registry->GetSystem<AudioSystem>().SubscribeToEvents(eventBus);
+    registry->GetSystem<ScriptEventSystem>().SubscribeToEvents(eventBus);
 
     // Update the registry to process the entities that are waiting to be created/deleted
     registry->Update();
 
     // Ask all the systems to update
     registry->GetSystem<MovementSystem>().Update(deltaTime);
-    registry->GetSystem<AnimationSystem>().Update();
+    registry->GetSystem<SineMotionSystem>().Update(deltaTime);
+    registry->GetSystem<PatrolBoundsSystem>().Update();
+    registry->GetSystem<FaceVelocitySystem>().Update();
     registry->GetSystem<CollisionSystem>().Update(eventBus);
     registry->GetSystem<ProjectileEmitSystem>().Update(registry);
     registry->GetSystem<CameraMovementSystem>().Update(camera);
+    registry->GetSystem<StreamingSystem>().Update(registry, camera);
     registry->GetSystem<ProjectileLifeCycleSystem>().Update();
     registry->GetSystem<ScriptSystem>().Update(deltaTime, SDL_GetTicks());
+    // The scripts react to the collisions and kills of the tick while the killed entities are still alive
+    registry->GetSystem<ScriptEventSystem>().Update(*registry, registry->GetSystem<ScriptSystem>().GetProfiler());
+
+    // Compute the visible set once the camera is settled, then animate only what can be seen
+    if (!isHeadless) {
+        registry->GetSystem<VisibilitySystem>().Update(camera);
+        registry->GetSystem<AnimationSystem>().Update(registry->GetSystem<VisibilitySystem>().GetVisibleEntities());
+        registry->GetSystem<AudioSystem>().Update(assetStore, camera);
+    }
+}
+
+void Game::ExtractRenderSnapshot(RenderSnapshot& snapshot) {
+    // Render the frame between the two last ticks so that the motion stays smooth at any refresh rate
+    const double alpha = interpolationAlpha;
+    SDL_Rect renderCamera = camera;
+    renderCamera.x = static_cast<int>(previousCamera.x + (camera.x - previousCamera.x) * alpha);
+    renderCamera.y = static_cast<int>(previousCamera.y + (camera.y - previousCamera.y) * alpha);
+
+    snapshot.Clear();
+    snapshot.camera = renderCamera;
+
+    // Invoke all the systems that need to render, sharing the visible set computed during the update
+    const auto& visibility = registry->GetSystem<VisibilitySystem>();
+    registry->GetSystem<RenderSystem>().Update(snapshot, assetStore, renderCamera, visibility.GetVisibleEntities(), alpha);
+    registry->GetSystem<RenderTextSystem>().Update(snapshot, assetStore, renderCamera, visibility);
+    registry->GetSystem<RenderHealthBarSystem>().Update(snapshot, assetStore, renderCamera, visibility.GetVisibleEntities(), alpha);
+    if (isDebug) {
+        registry->GetSystem<RenderColliderSystem>().Update(snapshot, renderCamera, alpha);
+    }
 }
 
 void Game::Render() {
     SDL_SetRenderDrawColor(renderer, 21, 21, 21, 255);
     SDL_RenderClear(renderer);
 
-    // Invoke all the systems that need to render
-    registry->GetSystem<RenderSystem>().Update(renderer, assetStore, camera);
-    registry->GetSystem<RenderTextSystem>().Update(renderer, assetStore, camera);
-    registry->GetSystem<RenderHealthBarSystem>().Update(renderer, assetStore, camera);
+    RenderSnapshot& snapshot = renderSnapshots[0];
+    ExtractRenderSnapshot(snapshot);
+    snapshot.Submit(renderer);
+
     if (isDebug) {
-        registry->GetSystem<RenderColliderSystem>().Update(renderer, camera);
-        registry->GetSystem<RenderGUISystem>().Update(registry, camera);
+        registry->GetSystem<RenderGUISystem>().Update(registry, camera, luaHeap.GetStats(), registry->GetSystem<ScriptSystem>().GetProfiler());
     }
 
     SDL_RenderPresent(renderer);
+    assetStore->Update();
+}
+
+void Game::SetPipelined(bool pipelined) {
+    isPipelined = pipelined;
+}
+
+void Game::SetHeadless(int numTicks) {
+    isHeadless = true;
+    numHeadlessTicks = numTicks;
+}
+
+void Game::SetTextureBudget(std::size_t budget) {
+    assetStore->SetTextureBudget(budget);
+}
+
+void Game::SetTextureLoadMode(TextureLoadMode loadMode) {
+    assetStore->SetTextureLoadMode(loadMode);
+}
+
+void Game::SetImageCacheEnabled(bool enabled) {
+    assetStore->SetImageCacheEnabled(enabled);
+}
+
+void Game::SetHotReloadEnabled(bool enabled) {
+    isHotReloadEnabled = enabled;
+}
+
+void Game::SetWorldStreamed(bool streamed) {
+    isWorldStreamed = streamed;
+}
+
+void Game::SetScriptProfiled(int sampleInstructionCount) {
+    scriptProfilerSampleCount = sampleInstructionCount;
+}
+
+void Game::ToggleScriptProfiler() {
+    ScriptProfiler& profiler = registry->GetSystem<ScriptSystem>().GetProfiler();
+    if (profiler.IsEnabled()) {
+        profiler.Disable();
+        profiler.ExportJson(SCRIPT_PROFILE_FILE_PATH);
+    } else {
+        profiler.Reset();
+        profiler.Enable(lua.lua_state(), scriptProfilerSampleCount > 0 ? scriptProfilerSampleCount : DEFAULT_SCRIPT_PROFILER_SAMPLE_COUNT);
+    }
 }
 
 void Game::Run() {
     Setup();
+    if (isHeadless) {
+        RunHeadless();
+        return;
+    }
+    if (isPipelined) {
+        RunPipelined();
+        return;
+    }
     while (isRunning)
     {
         ProcessInput();
-        Update();
+        AdvanceSimulation();
+        StepLuaGarbageCollector();
         Render();
     }
 }
 
+void Game::RunHeadless() {
+    const Uint64 startCounter = SDL_GetPerformanceCounter();
+    for (int tick = 0; tick < numHeadlessTicks && isRunning; tick++) {
+        Update();
+        luaHeap.StepGarbageCollector(lua.lua_state(), 0.0);
+    }
+    const double seconds = static_cast<double>(SDL_GetPerformanceCounter() - startCounter) / SDL_GetPerformanceFrequency();
+
+    Logger::Log("Headless run: " + std::to_string(numHeadlessTicks) + " ticks in " + std::to_string(seconds * 1000.0) + " ms");
+    if (numHeadlessTicks > 0 && seconds > 0) {
+        Logger::Log("Headless run: " + std::to_string(seconds * 1000000.0 / numHeadlessTicks) + " us per tick, " +
+                    std::to_string(numHeadlessTicks / seconds) + " ticks per second");
+    }
+
+    const LuaHeapStats& luaStats = luaHeap.GetStats();
+    Logger::Log("Headless run: " + std::to_string(luaStats.numAllocations) + " Lua allocations, " +
+                std::to_string(luaStats.numGcCycles) + " GC cycles in " + std::to_string(luaStats.totalGcTime) +
+                " ms, longest GC step " + std::to_string(luaStats.maxGcTime) + " ms");
+    isRunning = false;
+}
+
+void Game::RunPipelined() {
+    for (auto& snapshot: renderSnapshots) {
+        freeSnapshots.Push(&snapshot);
+    }
+
+    // The simulation thread owns the registry, the Lua state and the asset lookups from now on
+    std::thread simulationThread([this]() {
+        while (isRunning) {
+            {
+                std::unique_lock<std::mutex> lock(simulationPauseMutex);
+                if (isSimulationPauseRequested) {
+                    isSimulationPaused = true;
+                    simulationPauseCondition.notify_all();
+                    simulationPauseCondition.wait(lock, [this]() { return !isSimulationPauseRequested; });
+                    isSimulationPaused = false;
+                }
+            }
+
+            SDL_Keycode symbol;
+            while (pressedKeys.Pop(symbol)) {
+                eventBus->EmitEvent<KeyPressedEvent>(symbol);
+            }
+
+            // Nothing changed without a tick, sleep until the next one is due instead of extracting the same snapshot
+            if (AdvanceSimulation() == 0) {
+                std::this_thread::sleep_for(std::chrono::duration<double>(SECONDS_PER_TICK - tickAccumulator));
+                continue;
+            }
+            StepLuaGarbageCollector();
+
+            // Wait for the render thread to hand a snapshot back if all of them are still in flight
+            RenderSnapshot* snapshot = nullptr;
+            while (!freeSnapshots.Pop(snapshot)) {
+                if (!isRunning) {
+                    return;
+                }
+                SDL_Delay(1);
+            }
+            ExtractRenderSnapshot(*snapshot);
+            readySnapshots.Push(snapshot);
+        }
+    });
+
+    // The main thread keeps the window events and submits the most recent snapshot, waiting for vsync meanwhile
+    while (isRunning) {
+        ProcessInput();
+        if (isLevelReloadRequested.exchange(false)) {
+            ReloadLevelPipelined();
+        }
+
+        RenderSnapshot* snapshot = nullptr;
+        RenderSnapshot* latestSnapshot = nullptr;
+        while (readySnapshots.Pop(snapshot)) {
+            if (latestSnapshot) {
+                freeSnapshots.Push(latestSnapshot);
+            }
+            latestSnapshot = snapshot;
+        }
+        if (!latestSnapshot) {
+            SDL_Delay(1);
+            continue;
+        }
+
+        SDL_SetRenderDrawColor(renderer, 21, 21, 21, 255);
+        SDL_RenderClear(renderer);
+        latestSnapshot->Submit(renderer);
+        SDL_RenderPresent(renderer);
+        assetStore->Update();
+
+        freeSnapshots.Push(latestSnapshot);
+    }
+
+    simulationThread.join();
+}
+
 void Game::Destroy() {
-    ImGuiSDL::Deinitialize();
-    ImGui::DestroyContext();
-    SDL_DestroyRenderer(renderer);
-    SDL_DestroyWindow(window);
+    // Keep the profile of a game ended while profiling
+    if (registry->HasSystem<ScriptSystem>() && registry->GetSystem<ScriptSystem>().GetProfiler().IsEnabled()) {
+        ToggleScriptProfiler();
+    }
+
+    if (!isHeadless) {
+        // Release the textures and sounds while their renderer and audio device still exist
+        assetStore->ClearAssets();
+        Mix_CloseAudio();
+        ImGuiSDL::Deinitialize();
+        ImGui::DestroyContext();
+        SDL_DestroyRenderer(renderer);
+        SDL_DestroyWindow(window);
+    }
     SDL_Quit();
 }
 
@@ -4,14 +4,39 @@
 #include "../ECS/ECS.h"
 #include "../AssetStore/AssetStore.h"
 #include "../EventBus/EventBus.h"
+#include "../Renderer/RenderSnapshot.h"
+#include "../Concurrency/SpscQueue.h"
+#include "../FileWatcher/FileWatcher.h"
+#include "../Streaming/WorldStreamer.h"
+#include "../Scripting/LuaHeap.h"
 #include <SDL.h>
 #include <sol/sol.hpp>
+#include <array>
+#include <cstddef>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
 
-/// Expected frame per seconds value.
+/// Expected simulation ticks per seconds value, independent of the display refresh rate.
 const int FPS = 60;
 
-/// Computed expected time between two frames for a given number of frame per seconds.
-const int MILLISECS_PER_FRAME = 1000 / FPS;
+/// Computed fixed time, in seconds, simulated by every tick.
+const double SECONDS_PER_TICK = 1.0 / FPS;
+
+/// Maximum number of ticks simulated in a single frame to catch up after a slow frame.
+const int MAX_TICKS_PER_FRAME = 5;
+
+/// Virtual window width used when the game runs without any display.
+const int HEADLESS_WINDOW_WIDTH = 1920;
+
+/// Virtual window height used when the game runs without any display.
+const int HEADLESS_WINDOW_HEIGHT = 1080;
+
+/// Number of render snapshots in flight between the simulation and the render threads in pipelined mode.
+const int NUM_RENDER_SNAPSHOTS = 3;
+
+/// Maximum time, in seconds, spent collecting the Lua garbage in a frame, taken from the time left before the next tick.
+const double LUA_GC_FRAME_BUDGET = 0.001;
 
 /// Class responsible for calling all of our game code and keeping the game running.
 /// @file Game.h
@@ -20,25 +45,74 @@ const int MILLISECS_PER_FRAME = 1000 / FPS;
 class Game {
 private:
     /// Game running status indicator.
-    bool isRunning;
+    std::atomic<bool> isRunning;
     /// Game debug status indicator.
-    bool isDebug;
-    /// Time elapsed since last game frame.
-    int millisecsPreviousFrame = 0;
+    std::atomic<bool> isDebug;
+    /// Game pipelined rendering status indicator.
+    bool isPipelined;
+    /// Game headless status indicator, running without window, renderer nor GUI.
+    bool isHeadless;
+    /// Integer value representing the number of ticks to simulate in headless mode.
+    int numHeadlessTicks;
+    /// Integer value representing the number of the level being played.
+    int levelNumber;
+    /// Heap of the Lua state, declared before it so that it outlives it.
+    LuaHeap luaHeap;
+    /// TODO: comments
+    sol::state lua;
+    /// Game hot reload status indicator, reloading the changed assets while the game runs.
+    bool isHotReloadEnabled;
+    /// Level reload request indicator, set when the script or the tilemap of the level changed.
+    std::atomic<bool> isLevelReloadRequested;
+    /// Vector of the paths of the files the current level was loaded from, the only ones reloading it when changed.
+    std::vector<std::string> levelFiles;
+    /// Mutex guarding the simulation pause handshake of the pipelined mode.
+    std::mutex simulationPauseMutex;
+    /// Condition variable signaling the changes of the simulation pause handshake.
+    std::condition_variable simulationPauseCondition;
+    /// Simulation pause request indicator, set by the render thread to reload the level in pipelined mode.
+    bool isSimulationPauseRequested;
+    /// Simulation paused status indicator, set by the simulation thread while it waits for the pause to end.
+    bool isSimulationPaused;
+    /// File watcher reporting the asset files changed while the game runs.
+    std::unique_ptr<FileWatcher> fileWatcher;
+    /// Game world streaming status indicator, keeping in the registry only the chunks of the level around the camera.
+    bool isWorldStreamed;
+    /// World streamer of the level, when streamed.
+    std::unique_ptr<WorldStreamer> worldStreamer;
+    /// Integer value representing the number of Lua instructions between two script profiler samples, 0 to start
+    /// without profiling.
+    int scriptProfilerSampleCount;
+    /// Script profiler toggle request indicator, set by the 'p' key.
+    std::atomic<bool> isScriptProfilerToggleRequested;
+    /// Performance counter value at the previous frame.
+    Uint64 previousFrameCounter = 0;
+    /// Time, in seconds, elapsed but not simulated yet.
+    double tickAccumulator = 0.0;
+    /// Value between 0 and 1 representing the progress towards the next tick, used to interpolate rendering.
+    double interpolationAlpha = 0.0;
     /// Window object to display render buffers.
     SDL_Window* window;
     /// Renderer object to draw texture.
     SDL_Renderer* renderer;
     /// SDL Rectangle object defining the camera canvas size.
     SDL_Rect camera;
-    /// TODO: comments
-    sol::state lua;
+    /// SDL Rectangle object defining the camera canvas at the previous tick.
+    SDL_Rect previousCamera;
     /// Registry object of the game.
     std::unique_ptr<Registry> registry; // Registry* registry smart pointer
     /// Asset store of the game.
     std::unique_ptr<AssetStore> assetStore;
     /// Event bus flow of the game.
     std::unique_ptr<EventBus> eventBus;
+    /// Render snapshots the render systems record the draw commands of a frame in.
+    std::array<RenderSnapshot, NUM_RENDER_SNAPSHOTS> renderSnapshots;
+    /// Queue of the render snapshots free to be extracted by the simulation thread.
+    SpscQueue<RenderSnapshot*, NUM_RENDER_SNAPSHOTS + 1> freeSnapshots;
+    /// Queue of the render snapshots extracted and waiting to be submitted by the render thread.
+    SpscQueue<RenderSnapshot*, NUM_RENDER_SNAPSHOTS + 1> readySnapshots;
+    /// Queue of the keys pressed on the render thread, waiting to be emitted on the simulation thread.
+    SpscQueue<SDL_Keycode, 64> pressedKeys;
 
 public:
     /// Game window width value.
@@ -75,13 +149,105 @@ public:
     void ProcessInput();
 
     /// @brief Game update method
-    /// @details This method is responsible for processing the different actions - systems of the game at every frame.
+    /// @details This method is responsible for processing the different actions - systems of the game for one fixed tick.
     void Update();
 
+    /// @brief Game simulation advance method
+    /// @details This method is responsible for running as many fixed ticks as the time elapsed since the previous
+    /// frame requires, up to MAX_TICKS_PER_FRAME, and computing the interpolation value of the frame to render.
+    /// @return The number of ticks run.
+    int AdvanceSimulation();
+
+    /// @brief Lua garbage collection step method
+    /// @details This method is responsible for spending at most LUA_GC_FRAME_BUDGET of the time left before the next
+    /// tick collecting the Lua garbage, once per rendered frame, or once per batch of ticks in pipelined mode.
+    void StepLuaGarbageCollector();
+
     /// @brief Game render method
     /// @details This method is responsible for rendering all the entity of the game at every frame.
     void Render();
 
+    /// @brief Pipelined rendering setter
+    /// @details This method is responsible for enabling the pipelined mode, in which the simulation of the next frame
+    /// runs on a worker thread while the main thread submits the render snapshot of the previous one.
+    /// @param pipelined: Boolean value representing the pipelined rendering status to set.
+    void SetPipelined(bool pipelined);
+
+    /// @brief Headless mode setter
+    /// @details This method is responsible for enabling the headless mode, in which no video is initialized, textures
+    /// are only stubbed with their dimensions and the non-render systems run as fast as possible for a number of ticks.
+    /// Must be called before Initialize.
+    /// @param numTicks: Integer value representing the number of ticks to simulate.
+    void SetHeadless(int numTicks);
+
+    /// @brief Texture budget setter
+    /// @details This method is responsible for setting the memory budget above which the unreferenced textures get evicted.
+    /// @param budget: Integer value representing the budget, in bytes.
+    void SetTextureBudget(std::size_t budget);
+
+    /// @brief Texture load mode setter
+    /// @details This method is responsible for choosing between loading every texture of the level up front, or only
+    /// the ones used on screen, on their first use.
+    /// @param loadMode: TextureLoadMode value to set.
+    void SetTextureLoadMode(TextureLoadMode loadMode);
+
+    /// @brief Image cache enabled status setter
+    /// @details This method is responsible for enabling the on-disk cache keeping the decoded images between two runs.
+    /// @param enabled: Boolean value representing the enabled status to set.
+    void SetImageCacheEnabled(bool enabled);
+
+    /// @brief Hot reload enabled status setter
+    /// @details This method is responsible for enabling the reload of the textures, level scripts and tilemaps
+    /// written while the game runs. Must be called before Run.
+    /// @param enabled: Boolean value representing the enabled status to set.
+    void SetHotReloadEnabled(bool enabled);
+
+    /// @brief World streaming setter
+    /// @details This method is responsible for enabling the streaming of the level, in which the tiles and entities
+    /// are only created around the camera. Must be called before Run.
+    /// @param streamed: Boolean value representing the world streaming status to set.
+    void SetWorldStreamed(bool streamed);
+
+    /// @brief Script profiling setter
+    /// @details This method is responsible for starting the game with the script profiler enabled, the profile being
+    /// exported when the game ends. Must be called before Run.
+    /// @param sampleInstructionCount: Integer value representing the number of Lua instructions between two samples.
+    void SetScriptProfiled(int sampleInstructionCount);
+
+    /// @brief Script profiler toggle method
+    /// @details This method is responsible for enabling the script profiler, or disabling it and exporting its profile.
+    void ToggleScriptProfiler();
+
+    /// @brief Changed assets processing method
+    /// @details This method is responsible for collecting the asset files written since the previous frame, updating
+    /// the changed textures in place and requesting a level reload when the script or tilemap of the level changed.
+    void ProcessChangedAssets();
+
+    /// @brief Level reload method
+    /// @details This method is responsible for destroying every entity and loading the current level again, putting
+    /// the tagged entities, such as the player, back where they were with their velocity and health. The other
+    /// entities start over from the level script. Creates textures, so it runs on the render thread, the simulation
+    /// thread being paused in pipelined mode.
+    void ReloadLevel();
+
+    /// @brief Pipelined level reload method
+    /// @details This method is responsible for pausing the simulation thread at the end of its tick, dropping the
+    /// snapshots extracted before the reload, reloading the level on the render thread and resuming the simulation.
+    void ReloadLevelPipelined();
+
+    /// @brief Game headless run method
+    /// @details This method is responsible for simulating the requested number of ticks without rendering, and logging their cost.
+    void RunHeadless();
+
+    /// @brief Game pipelined run method
+    /// @details This method is responsible for running the game loop with the simulation and the rendering overlapped.
+    void RunPipelined();
+
+    /// @brief Render snapshot extraction method
+    /// @details This method is responsible for asking all the render systems to record their draw commands in the given snapshot.
+    /// @param snapshot: The render snapshot to fill.
+    void ExtractRenderSnapshot(RenderSnapshot& snapshot);
+
     /// @brief Game destroy method
     /// @details This method is responsible for cleaning the screen and clearing all the different elements constituting of the game.
     void Destroy();
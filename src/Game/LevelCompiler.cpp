@@ -0,0 +1,710 @@
+#include "LevelCompiler.h"
+#include "../AssetStore/ImageCache.h"
+#include "../Logger/Logger.h"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+
+namespace fs = std::filesystem;
+
+/// Magic number opening every compiled level file.
+static const char COMPILED_LEVEL_MAGIC[4] = {'P', 'C', 'L', 'V'};
+/// Version of the compiled level file layout, to be increased whenever a record changes.
+static const std::uint32_t COMPILED_LEVEL_VERSION = 9;
+/// Smallest size of an entity record, its tag and group lengths followed by its component flags.
+static const std::size_t MIN_ENTITY_RECORD_SIZE = 3 * sizeof(std::uint32_t);
+
+/// Magic number opening every level bytecode file.
+static const char LEVEL_BYTECODE_MAGIC[4] = {'P', 'C', 'L', 'B'};
+/// Version of the level bytecode file layout, to be increased whenever its header changes.
+static const std::uint32_t LEVEL_BYTECODE_VERSION = 2;
+
+/// Library functions whose results change between two runs, tracked while a script is compiled.
+static const char* VOLATILE_FUNCTIONS[][2] = {
+        {"os", "date"},
+        {"os", "time"},
+        {"os", "clock"},
+        {"math", "random"}
+};
+
+/// Lua chunk building the wrappers of the volatile functions, raising the captured flag when called.
+/// @details When shifted, a wrapper returns another value than the original function would have, as if the script ran
+/// half a day later with other random numbers.
+static const char* VOLATILE_TRACKER =
+        "local flag, isShifted = ...\n"
+        "local time = os.time\n"
+        "local shifts = {\n"
+        "    date = function(original, format, t) return original(format, (t or time()) + 45000) end,\n"
+        "    time = function(original, ...) return original(...) + 45000 end,\n"
+        "    clock = function(original) return original() + 45000 end,\n"
+        "    random = function(original, ...)\n"
+        "        local value = original(...)\n"
+        "        local count, m, n = select('#', ...), ...\n"
+        "        if count == 0 then return (value + 0.5) % 1 end\n"
+        "        if count == 1 then m, n = 1, m end\n"
+        "        if n <= m then return value end\n"
+        "        return m + (value - m + 1) % (n - m + 1)\n"
+        "    end\n"
+        "}\n"
+        "return function(name, original)\n"
+        "    local shift = shifts[name]\n"
+        "    return function(...)\n"
+        "        flag.isVolatile = true\n"
+        "        if isShifted then return shift(original, ...) end\n"
+        "        return original(...)\n"
+        "    end\n"
+        "end\n";
+
+/// Structure appending the values of a compiled level to a byte buffer.
+struct CompiledLevelWriter {
+    /// String object holding the bytes written so far.
+    std::string buffer;
+
+    template <typename T>
+    void Write(T value) {
+        static_assert(std::is_trivially_copyable<T>::value, "Only plain values are written as is");
+        buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    void Write(bool value) {
+        Write(static_cast<std::uint8_t>(value ? 1 : 0));
+    }
+
+    void Write(const std::string& value) {
+        Write(static_cast<std::uint32_t>(value.size()));
+        buffer.append(value);
+    }
+
+    void Write(const glm::vec2& value) {
+        Write(value.x);
+        Write(value.y);
+    }
+};
+
+/// Structure reading back the values of a compiled level from a byte buffer, failing past its end.
+struct CompiledLevelReader {
+    /// String object holding the bytes to read.
+    const std::string& buffer;
+    /// Integer value representing the position of the next byte to read.
+    std::size_t position = 0;
+    /// Boolean value representing the success status of every read so far.
+    bool isValid = true;
+
+    template <typename T>
+    void Read(T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "Only plain values are read as is");
+        if (!isValid || buffer.size() - position < sizeof(T)) {
+            isValid = false;
+            return;
+        }
+        std::memcpy(&value, buffer.data() + position, sizeof(T));
+        position += sizeof(T);
+    }
+
+    void Read(bool& value) {
+        std::uint8_t byte = 0;
+        Read(byte);
+        value = byte != 0;
+    }
+
+    void Read(std::string& value) {
+        std::uint32_t size = 0;
+        Read(size);
+        if (!isValid || buffer.size() - position < size) {
+            isValid = false;
+            return;
+        }
+        value.assign(buffer, position, size);
+        position += size;
+    }
+
+    void Read(glm::vec2& value) {
+        Read(value.x);
+        Read(value.y);
+    }
+};
+
+/// @brief Visit every field of an entity description, in the file order.
+template <typename TVisitor, typename TEntity>
+static void VisitEntityFields(TVisitor&& visit, TEntity& entity) {
+    visit(entity.tag);
+    visit(entity.group);
+    visit(entity.components);
+    if (entity.components & LEVEL_COMPONENT_TRANSFORM) {
+        visit(entity.transform.position);
+        visit(entity.transform.scale);
+        visit(entity.transform.rotation);
+    }
+    if (entity.components & LEVEL_COMPONENT_RIGIDBODY) {
+        visit(entity.rigidbody.velocity);
+    }
+    if (entity.components & LEVEL_COMPONENT_SPRITE) {
+        visit(entity.sprite.assetId);
+        visit(entity.sprite.width);
+        visit(entity.sprite.height);
+        visit(entity.sprite.zIndex);
+        visit(entity.sprite.isFixed);
+        visit(entity.sprite.srcRectX);
+        visit(entity.sprite.srcRectY);
+    }
+    if (entity.components & LEVEL_COMPONENT_ANIMATION) {
+        visit(entity.animation.numFrames);
+        visit(entity.animation.frameSpeedRate);
+    }
+    if (entity.components & LEVEL_COMPONENT_BOXCOLLIDER) {
+        visit(entity.boxCollider.width);
+        visit(entity.boxCollider.height);
+        visit(entity.boxCollider.offset);
+    }
+    if (entity.components & LEVEL_COMPONENT_HEALTH) {
+        visit(entity.health.healthPercentage);
+    }
+    if (entity.components & LEVEL_COMPONENT_PROJECTILE_EMITTER) {
+        visit(entity.projectileEmitter.projectileVelocity);
+        visit(entity.projectileEmitter.repeatFrequency);
+        visit(entity.projectileEmitter.projectileDuration);
+        visit(entity.projectileEmitter.hitPercentDamage);
+        visit(entity.projectileEmitter.isFriendly);
+        visit(entity.projectileEmitter.soundAssetId);
+        visit(entity.projectileEmitter.soundPriority);
+    }
+    if (entity.components & LEVEL_COMPONENT_SOUND_EMITTER) {
+        visit(entity.soundEmitter.assetId);
+        visit(entity.soundEmitter.priority);
+        visit(entity.soundEmitter.volume);
+    }
+    if (entity.components & LEVEL_COMPONENT_KEYBOARD_CONTROLLED) {
+        visit(entity.keyboardControlled.upVelocity);
+        visit(entity.keyboardControlled.rightVelocity);
+        visit(entity.keyboardControlled.downVelocity);
+        visit(entity.keyboardControlled.leftVelocity);
+    }
+    if (entity.components & LEVEL_COMPONENT_SINE_MOTION) {
+        visit(entity.sineMotion.origin);
+        visit(entity.sineMotion.velocity);
+        visit(entity.sineMotion.amplitude);
+        visit(entity.sineMotion.frequency);
+        visit(entity.sineMotion.phase);
+    }
+    if (entity.components & LEVEL_COMPONENT_PATROL_BOUNDS) {
+        visit(entity.patrolBounds.nearMargin);
+        visit(entity.patrolBounds.farMargin);
+    }
+    if (entity.components & LEVEL_COMPONENT_FACE_VELOCITY) {
+        visit(entity.faceVelocity.angleOffset);
+        visit(entity.faceVelocity.isAimingProjectiles);
+    }
+    if (entity.components & LEVEL_COMPONENT_SCRIPT) {
+        visit(entity.script.isBatched);
+        visit(entity.script.interval);
+        visit(entity.script.isCoroutine);
+        visit(entity.script.isPure);
+    }
+}
+
+/// @brief Visit every field of a level description, in the file order.
+template <typename TVisitor, typename TLevel>
+static void VisitLevelFields(TVisitor&& visit, TLevel& level) {
+    visit(level.hasScripts);
+    visit(level.isVolatile);
+    visit(level.hasVolatileEntities);
+    visit(level.musicAssetId);
+    visit(level.tilemap.mapFilePath);
+    visit(level.tilemap.textureAssetId);
+    visit(level.tilemap.numRows);
+    visit(level.tilemap.numCols);
+    visit(level.tilemap.tileSize);
+    visit(level.tilemap.tilesPerRow);
+    visit(level.tilemap.scale);
+}
+
+/// @brief Serialize the entities of a level description, count first.
+static void WriteLevelEntities(CompiledLevelWriter& writer, const std::vector<LevelEntityDescription>& entities) {
+    auto write = [&writer](const auto& value) { writer.Write(value); };
+    writer.Write(static_cast<std::uint32_t>(entities.size()));
+    for (const auto& entity: entities) {
+        VisitEntityFields(write, entity);
+    }
+}
+
+/// @brief Read a vector2 from a Lua table holding x and y fields.
+static glm::vec2 ReadVector(const sol::table& table, const char* key, float defaultValue) {
+    sol::optional<sol::table> vector = table[key];
+    if (vector == sol::nullopt) {
+        return glm::vec2(defaultValue);
+    }
+    return glm::vec2(vector.value()["x"].get_or(defaultValue), vector.value()["y"].get_or(defaultValue));
+}
+
+LevelCompiler::LevelCompiler(std::string directory): directory(std::move(directory)) {}
+
+bool LevelCompiler::Compile(sol::state& lua, int levelNumber, LevelDescription& level) const {
+    const std::string scriptPath = GetScriptPath(levelNumber);
+    std::ifstream scriptFile(scriptPath, std::ios::binary);
+    if (!scriptFile) {
+        Logger::Err("Error opening the lua script " + scriptPath);
+        return false;
+    }
+    const std::string script((std::istreambuf_iterator<char>(scriptFile)), std::istreambuf_iterator<char>());
+    const std::uint64_t scriptHash = ImageCache::Hash(script.data(), script.size());
+    const std::string compiledPath = directory + "/Level" + std::to_string(levelNumber) + ".pclv";
+    const std::string bytecodePath = directory + "/Level" + std::to_string(levelNumber) + ".luac";
+
+    if (ReadCompiledLevel(compiledPath, scriptHash, level)) {
+        if (level.hasScripts || level.isVolatile) {
+            sol::protected_function chunk = LoadScript(lua, script, scriptPath, scriptHash, bytecodePath);
+            if (!chunk.valid() || !RunScript(lua, chunk, nullptr, false)) {
+                return false;
+            }
+        }
+        if (level.isVolatile) {
+            // Only the values changing from one run to the other are read again from the fresh table
+            ReadLevelHeader(lua["Level"], level);
+            if (level.hasVolatileEntities) {
+                ReadLevelEntities(lua["Level"], level);
+            }
+        }
+        Logger::Log("Level " + std::to_string(levelNumber) + " read from its compiled file");
+        return true;
+    }
+
+    level = LevelDescription();
+    sol::protected_function chunk = LoadScript(lua, script, scriptPath, scriptHash, bytecodePath);
+    // The first run feeds other values to the volatile functions, a script not calling any running as usual
+    if (!chunk.valid() || !RunScript(lua, chunk, &level.isVolatile, true)) {
+        return false;
+    }
+    sol::optional<sol::table> levelTable = lua["Level"];
+    if (levelTable == sol::nullopt) {
+        Logger::Err("The lua script " + scriptPath + " does not define any Level table");
+        return false;
+    }
+
+    // The entities of a volatile script are only left out of the cache when they differ between the two runs
+    LevelDescription shiftedLevel;
+    if (level.isVolatile) {
+        ReadLevelEntities(levelTable.value(), shiftedLevel);
+        if (!RunScript(lua, chunk, nullptr, false)) {
+            return false;
+        }
+        levelTable = lua["Level"];
+        if (levelTable == sol::nullopt) {
+            Logger::Err("The lua script " + scriptPath + " does not define any Level table");
+            return false;
+        }
+    }
+    ReadLevelHeader(levelTable.value(), level);
+    ReadLevelEntities(levelTable.value(), level);
+    if (level.isVolatile) {
+        CompiledLevelWriter entities;
+        CompiledLevelWriter shiftedEntities;
+        WriteLevelEntities(entities, level.entities);
+        WriteLevelEntities(shiftedEntities, shiftedLevel.entities);
+        level.hasVolatileEntities = entities.buffer != shiftedEntities.buffer;
+    }
+    WriteCompiledLevel(compiledPath, scriptHash, level);
+    Logger::Log("Level " + std::to_string(levelNumber) + " compiled from " + scriptPath);
+    return true;
+}
+
+bool LevelCompiler::RunLevelScript(sol::state& lua, int levelNumber) const {
+    const std::string scriptPath = GetScriptPath(levelNumber);
+    std::ifstream scriptFile(scriptPath, std::ios::binary);
+    if (!scriptFile) {
+        Logger::Err("Error opening the lua script " + scriptPath);
+        return false;
+    }
+    const std::string script((std::istreambuf_iterator<char>(scriptFile)), std::istreambuf_iterator<char>());
+    const std::uint64_t scriptHash = ImageCache::Hash(script.data(), script.size());
+    const std::string bytecodePath = directory + "/Level" + std::to_string(levelNumber) + ".luac";
+
+    sol::protected_function chunk = LoadScript(lua, script, scriptPath, scriptHash, bytecodePath);
+    return chunk.valid() && RunScript(lua, chunk, nullptr, false);
+}
+
+std::string LevelCompiler::GetScriptPath(int levelNumber) {
+    return "./../assets/scripts/Level" + std::to_string(levelNumber) + ".lua";
+}
+
+/// @brief lua_Writer appending the dumped bytecode to a string.
+static int AppendBytecode(lua_State*, const void* bytes, std::size_t size, void* bytecode) {
+    static_cast<std::string*>(bytecode)->append(static_cast<const char*>(bytes), size);
+    return 0;
+}
+
+sol::protected_function LevelCompiler::LoadScript(sol::state& lua, const std::string& script, const std::string& scriptPath,
+                                                  std::uint64_t scriptHash, const std::string& bytecodePath) const {
+    // Skip the parsing when the bytecode of this very script was dumped by a previous run
+    std::ifstream bytecodeFile(bytecodePath, std::ios::binary);
+    if (bytecodeFile) {
+        const std::string buffer((std::istreambuf_iterator<char>(bytecodeFile)), std::istreambuf_iterator<char>());
+        CompiledLevelReader reader = {buffer};
+        char magic[4] = {};
+        std::uint32_t version = 0;
+        std::uint32_t luaVersion = 0;
+        std::uint64_t bytecodeScriptHash = 0;
+        std::uint64_t payloadHash = 0;
+        for (auto& character: magic) {
+            reader.Read(character);
+        }
+        reader.Read(version);
+        reader.Read(luaVersion);
+        reader.Read(bytecodeScriptHash);
+        reader.Read(payloadHash);
+        // Lua does not verify binary chunks, a truncated or corrupted payload must never reach the binary load
+        if (reader.isValid && std::memcmp(magic, LEVEL_BYTECODE_MAGIC, sizeof(magic)) == 0 &&
+            version == LEVEL_BYTECODE_VERSION && luaVersion == LUA_VERSION_NUM && bytecodeScriptHash == scriptHash &&
+            payloadHash == ImageCache::Hash(buffer.data() + reader.position, buffer.size() - reader.position)) {
+            sol::load_result chunk = lua.load_buffer(buffer.data() + reader.position, buffer.size() - reader.position,
+                                                     "@" + scriptPath, sol::load_mode::binary);
+            if (chunk.valid()) {
+                return chunk;
+            }
+        }
+    }
+
+    // Only parsed here, the syntax errors are reported before anything runs
+    sol::load_result chunk = lua.load_buffer(script.data(), script.size(), "@" + scriptPath, sol::load_mode::text);
+    if (!chunk.valid()) {
+        sol::error err = chunk;
+        std::string errorMessage = err.what();
+        Logger::Err("Error loading the lua script: " + errorMessage);
+        return sol::protected_function();
+    }
+    sol::protected_function function = chunk;
+
+    CompiledLevelWriter writer;
+    writer.buffer.append(LEVEL_BYTECODE_MAGIC, sizeof(LEVEL_BYTECODE_MAGIC));
+    writer.Write(LEVEL_BYTECODE_VERSION);
+    writer.Write(static_cast<std::uint32_t>(LUA_VERSION_NUM));
+    writer.Write(scriptHash);
+    std::string bytecode;
+    lua_State* luaState = lua.lua_state();
+    function.push();
+    const int dumpStatus = lua_dump(luaState, AppendBytecode, &bytecode, 0);
+    lua_pop(luaState, 1);
+    if (dumpStatus == 0) {
+        writer.Write(ImageCache::Hash(bytecode.data(), bytecode.size()));
+        writer.buffer.append(bytecode);
+        WriteCacheFile(bytecodePath, writer.buffer);
+    }
+    return function;
+}
+
+bool LevelCompiler::RunScript(sol::state& lua, const sol::protected_function& chunk, bool* isVolatile, bool isShifted) {
+    // Swap the volatile functions for wrappers raising a flag, for as long as the script runs
+    // The flag lives in a table captured by the wrappers, never in the globals the level script sees
+    std::vector<std::tuple<sol::table, const char*, sol::object>> trackedFunctions;
+    sol::table flag;
+    if (isVolatile) {
+        flag = lua.create_table();
+        sol::protected_function track = lua.load(VOLATILE_TRACKER)(flag, isShifted);
+        for (const auto& volatileFunction: VOLATILE_FUNCTIONS) {
+            sol::optional<sol::table> library = lua[volatileFunction[0]];
+            if (library == sol::nullopt) {
+                continue;
+            }
+            sol::object original = library.value()[volatileFunction[1]];
+            if (original.get_type() != sol::type::function) {
+                continue;
+            }
+            library.value()[volatileFunction[1]] = track(volatileFunction[1], original);
+            trackedFunctions.emplace_back(library.value(), volatileFunction[1], original);
+        }
+    }
+
+    sol::protected_function_result result = chunk();
+
+    for (auto& trackedFunction: trackedFunctions) {
+        std::get<0>(trackedFunction)[std::get<1>(trackedFunction)] = std::get<2>(trackedFunction);
+    }
+    if (isVolatile) {
+        *isVolatile = flag["isVolatile"].get_or(false);
+    }
+
+    if (!result.valid()) {
+        sol::error err = result;
+        std::string errorMessage = err.what();
+        Logger::Err("Error running the lua script: " + errorMessage);
+        return false;
+    }
+    return true;
+}
+
+void LevelCompiler::ReadLevelHeader(const sol::table& levelTable, LevelDescription& level) {
+    level.assets.clear();
+    sol::table assets = levelTable["assets"];
+    for (int i = 0; ; i++) {
+        sol::optional<sol::table> hasAsset = assets[i];
+        if (hasAsset == sol::nullopt) {
+            break;
+        }
+        sol::table asset = hasAsset.value();
+        LevelAssetDescription description;
+        description.type = asset["type"];
+        description.id = asset["id"];
+        description.filePath = asset["file"];
+        description.fontSize = asset["font_size"].get_or(0);
+        level.assets.push_back(description);
+    }
+
+    sol::table map = levelTable["tilemap"];
+    level.tilemap.mapFilePath = map["map_file"];
+    level.tilemap.textureAssetId = map["texture_asset_id"];
+    level.tilemap.numRows = map["num_rows"];
+    level.tilemap.numCols = map["num_cols"];
+    level.tilemap.tileSize = map["tile_size"];
+    level.tilemap.tilesPerRow = map["tiles_per_row"].get_or(10);
+    level.tilemap.scale = map["scale"];
+
+    level.musicAssetId = levelTable["music"].get_or(std::string());
+}
+
+void LevelCompiler::ReadLevelEntities(const sol::table& levelTable, LevelDescription& level) {
+    level.entities.clear();
+    level.hasScripts = false;
+    sol::table entities = levelTable["entities"];
+    for (int i = 0; ; i++) {
+        sol::optional<sol::table> hasEntity = entities[i];
+        if (hasEntity == sol::nullopt) {
+            break;
+        }
+        sol::table entity = hasEntity.value();
+        LevelEntityDescription description;
+        description.tag = entity["tag"].get_or(std::string());
+        description.group = entity["group"].get_or(std::string());
+
+        sol::optional<sol::table> hasComponents = entity["components"];
+        if (hasComponents != sol::nullopt) {
+            sol::table components = hasComponents.value();
+
+            sol::optional<sol::table> transform = components["transform"];
+            if (transform != sol::nullopt) {
+                description.components |= LEVEL_COMPONENT_TRANSFORM;
+                description.transform.position = glm::vec2(transform.value()["position"]["x"].get<float>(), transform.value()["position"]["y"].get<float>());
+                description.transform.scale = ReadVector(transform.value(), "scale", 1.0f);
+                description.transform.rotation = ReadVector(transform.value(), "rotation", 0.0f);
+            }
+
+            sol::optional<sol::table> rigidbody = components["rigidbody"];
+            if (rigidbody != sol::nullopt) {
+                description.components |= LEVEL_COMPONENT_RIGIDBODY;
+                description.rigidbody.velocity = ReadVector(rigidbody.value(), "velocity", 0.0f);
+            }
+
+            sol::optional<sol::table> sprite = components["sprite"];
+            if (sprite != sol::nullopt) {
+                description.components |= LEVEL_COMPONENT_SPRITE;
+                description.sprite.assetId = sprite.value()["texture_asset_id"];
+                description.sprite.width = sprite.value()["width"];
+                description.sprite.height = sprite.value()["height"];
+                description.sprite.zIndex = sprite.value()["z_index"].get_or(1);
+                description.sprite.isFixed = sprite.value()["fixed"].get_or(false);
+                description.sprite.srcRectX = sprite.value()["src_rect_x"].get_or(0);
+                description.sprite.srcRectY = sprite.value()["src_rect_y"].get_or(0);
+            }
+
+            sol::optional<sol::table> animation = components["animation"];
+            if (animation != sol::nullopt) {
+                description.components |= LEVEL_COMPONENT_ANIMATION;
+                description.animation.numFrames = animation.value()["num_frames"].get_or(1);
+                description.animation.frameSpeedRate = animation.value()["speed_rate"].get_or(1);
+            }
+
+            sol::optional<sol::table> collider = components["boxcollider"];
+            if (collider != sol::nullopt) {
+                description.components |= LEVEL_COMPONENT_BOXCOLLIDER;
+                description.boxCollider.width = collider.value()["width"];
+                description.boxCollider.height = collider.value()["height"];
+                description.boxCollider.offset = ReadVector(collider.value(), "offset", 0.0f);
+            }
+
+            sol::optional<sol::table> health = components["health"];
+            if (health != sol::nullopt) {
+                description.components |= LEVEL_COMPONENT_HEALTH;
+                description.health.healthPercentage = static_cast<int>(health.value()["health_percentage"].get_or(100));
+            }
+
+            sol::optional<sol::table> projectileEmitter = components["projectile_emitter"];
+            if (projectileEmitter != sol::nullopt) {
+                sol::table emitter = projectileEmitter.value();
+                description.components |= LEVEL_COMPONENT_PROJECTILE_EMITTER;
+                description.projectileEmitter.projectileVelocity = glm::vec2(emitter["projectile_velocity"]["x"].get<float>(), emitter["projectile_velocity"]["y"].get<float>());
+                description.projectileEmitter.repeatFrequency = static_cast<int>(emitter["repeat_frequency"].get_or(1)) * 1000;
+                description.projectileEmitter.projectileDuration = static_cast<int>(emitter["projectile_duration"].get_or(10)) * 1000;
+                description.projectileEmitter.hitPercentDamage = static_cast<int>(emitter["hit_percentage_damage"].get_or(10));
+                description.projectileEmitter.isFriendly = emitter["friendly"].get_or(false);
+                description.projectileEmitter.soundAssetId = emitter["sound_asset_id"].get_or(std::string());
+                description.projectileEmitter.soundPriority = static_cast<int>(emitter["sound_priority"].get_or(1));
+            }
+
+            sol::optional<sol::table> soundEmitter = components["sound_emitter"];
+            if (soundEmitter != sol::nullopt) {
+                description.components |= LEVEL_COMPONENT_SOUND_EMITTER;
+                description.soundEmitter.assetId = soundEmitter.value()["sound_asset_id"];
+                description.soundEmitter.priority = static_cast<int>(soundEmitter.value()["priority"].get_or(1));
+                description.soundEmitter.volume = static_cast<int>(soundEmitter.value()["volume"].get_or(128));
+            }
+
+            sol::optional<sol::table> cameraFollow = components["camera_follow"];
+            if (cameraFollow != sol::nullopt) {
+                description.components |= LEVEL_COMPONENT_CAMERA_FOLLOW;
+            }
+
+            sol::optional<sol::table> keyboardControlled = components["keyboard_controller"];
+            if (keyboardControlled != sol::nullopt) {
+                description.components |= LEVEL_COMPONENT_KEYBOARD_CONTROLLED;
+                description.keyboardControlled.upVelocity = ReadVector(keyboardControlled.value(), "up_velocity", 0.0f);
+                description.keyboardControlled.rightVelocity = ReadVector(keyboardControlled.value(), "right_velocity", 0.0f);
+                description.keyboardControlled.downVelocity = ReadVector(keyboardControlled.value(), "down_velocity", 0.0f);
+                description.keyboardControlled.leftVelocity = ReadVector(keyboardControlled.value(), "left_velocity", 0.0f);
+            }
+
+            sol::optional<sol::table> sineMotion = components["sine_motion"];
+            if (sineMotion != sol::nullopt) {
+                description.components |= LEVEL_COMPONENT_SINE_MOTION;
+                description.sineMotion.origin = ReadVector(sineMotion.value(), "origin", 0.0f);
+                description.sineMotion.velocity = ReadVector(sineMotion.value(), "velocity", 0.0f);
+                description.sineMotion.amplitude = ReadVector(sineMotion.value(), "amplitude", 0.0f);
+                description.sineMotion.frequency = ReadVector(sineMotion.value(), "frequency", 0.0f);
+                description.sineMotion.phase = ReadVector(sineMotion.value(), "phase", 0.0f);
+            }
+
+            sol::optional<sol::table> patrolBounds = components["patrol_bounds"];
+            if (patrolBounds != sol::nullopt) {
+                description.components |= LEVEL_COMPONENT_PATROL_BOUNDS;
+                description.patrolBounds.nearMargin = ReadVector(patrolBounds.value(), "near_margin", 0.0f);
+                description.patrolBounds.farMargin = ReadVector(patrolBounds.value(), "far_margin", 0.0f);
+            }
+
+            sol::optional<sol::table> faceVelocity = components["face_velocity"];
+            if (faceVelocity != sol::nullopt) {
+                description.components |= LEVEL_COMPONENT_FACE_VELOCITY;
+                description.faceVelocity.angleOffset = faceVelocity.value()["angle_offset"].get_or(0.0);
+                description.faceVelocity.isAimingProjectiles = faceVelocity.value()["aim_projectiles"].get_or(false);
+            }
+
+            // The function itself stays in the Lua state, fetched again by entity index when instantiated
+            sol::optional<sol::table> script = components["on_update_script"];
+            if (script != sol::nullopt) {
+                description.components |= LEVEL_COMPONENT_SCRIPT;
+                description.script.isBatched = script.value()["batch"].get_or(false);
+                description.script.interval = script.value()["interval"].get_or(0.0);
+                description.script.isCoroutine = script.value()["coroutine"].get_or(false);
+                description.script.isPure = script.value()["pure"].get_or(false);
+                level.hasScripts = true;
+            }
+
+            // Same for the event handlers, plain functions
+            if (components["on_collision"].get_type() == sol::type::function ||
+                components["on_killed"].get_type() == sol::type::function) {
+                description.components |= LEVEL_COMPONENT_SCRIPT_EVENT_HANDLER;
+                level.hasScripts = true;
+            }
+        }
+        level.entities.push_back(description);
+    }
+}
+
+bool LevelCompiler::ReadCompiledLevel(const std::string& filePath, std::uint64_t scriptHash, LevelDescription& level) {
+    std::ifstream compiledFile(filePath, std::ios::binary);
+    if (!compiledFile) {
+        return false;
+    }
+    const std::string buffer((std::istreambuf_iterator<char>(compiledFile)), std::istreambuf_iterator<char>());
+
+    CompiledLevelReader reader = {buffer};
+    char magic[4] = {};
+    std::uint32_t version = 0;
+    std::uint64_t compiledScriptHash = 0;
+    for (auto& character: magic) {
+        reader.Read(character);
+    }
+    reader.Read(version);
+    reader.Read(compiledScriptHash);
+    if (!reader.isValid || std::memcmp(magic, COMPILED_LEVEL_MAGIC, sizeof(magic)) != 0 ||
+        version != COMPILED_LEVEL_VERSION || compiledScriptHash != scriptHash) {
+        return false;
+    }
+
+    LevelDescription compiledLevel;
+    auto read = [&reader](auto& value) { reader.Read(value); };
+    VisitLevelFields(read, compiledLevel);
+
+    std::uint32_t numAssets = 0;
+    reader.Read(numAssets);
+    for (std::uint32_t i = 0; i < numAssets && reader.isValid; i++) {
+        LevelAssetDescription asset;
+        reader.Read(asset.type);
+        reader.Read(asset.id);
+        reader.Read(asset.filePath);
+        reader.Read(asset.fontSize);
+        compiledLevel.assets.push_back(asset);
+    }
+
+    std::uint32_t numEntities = 0;
+    reader.Read(numEntities);
+    if (reader.isValid && numEntities > (buffer.size() - reader.position) / MIN_ENTITY_RECORD_SIZE) {
+        Logger::Err("The compiled level file " + filePath + " holds more entities than it has bytes left");
+        return false;
+    }
+    if (reader.isValid) {
+        compiledLevel.entities.resize(numEntities);
+    }
+    for (std::uint32_t i = 0; i < numEntities && reader.isValid; i++) {
+        VisitEntityFields(read, compiledLevel.entities[i]);
+    }
+
+    if (!reader.isValid) {
+        Logger::Err("The compiled level file " + filePath + " is truncated");
+        return false;
+    }
+    level = std::move(compiledLevel);
+    return true;
+}
+
+void LevelCompiler::WriteCompiledLevel(const std::string& filePath, std::uint64_t scriptHash, const LevelDescription& level) const {
+    CompiledLevelWriter writer;
+    writer.buffer.append(COMPILED_LEVEL_MAGIC, sizeof(COMPILED_LEVEL_MAGIC));
+    writer.Write(COMPILED_LEVEL_VERSION);
+    writer.Write(scriptHash);
+
+    auto write = [&writer](const auto& value) { writer.Write(value); };
+    VisitLevelFields(write, level);
+
+    writer.Write(static_cast<std::uint32_t>(level.assets.size()));
+    for (const auto& asset: level.assets) {
+        writer.Write(asset.type);
+        writer.Write(asset.id);
+        writer.Write(asset.filePath);
+        writer.Write(asset.fontSize);
+    }
+
+    // The volatile entities are read again from the script on every load
+    WriteLevelEntities(writer, level.hasVolatileEntities ? std::vector<LevelEntityDescription>() : level.entities);
+
+    WriteCacheFile(filePath, writer.buffer);
+}
+
+void LevelCompiler::WriteCacheFile(const std::string& filePath, const std::string& buffer) const {
+    std::error_code error;
+    fs::create_directories(directory, error);
+    const std::string temporaryPath = filePath + ".tmp";
+    {
+        std::ofstream temporaryFile(temporaryPath, std::ios::binary);
+        temporaryFile.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        if (!temporaryFile) {
+            Logger::Err("Error writing the level cache file " + temporaryPath);
+            temporaryFile.close();
+            fs::remove(temporaryPath, error);
+            return;
+        }
+    }
+    fs::rename(temporaryPath, filePath, error);
+    if (error) {
+        fs::remove(temporaryPath, error);
+    }
+}
@@ -0,0 +1,89 @@
+#ifndef LEVELCOMPILER_H
+#define LEVELCOMPILER_H
+
+#include "./LevelDescription.h"
+#include <sol/sol.hpp>
+#include <cstdint>
+#include <string>
+
+/// Class responsible for turning the Lua script of a level into a LevelDescription, cached in a binary file.
+/// @details The evaluated Level table is walked once and its component records are written to a cache file keyed by
+/// the hash of the script. As long as the script is unchanged, the description is read back from that file without
+/// walking the table again. Lua still runs the script when the level has script functions to hand out, and when the
+/// script reads values changing between two runs (the time, random numbers): the assets, tilemap and music are then
+/// read again from the fresh table. The script then runs twice when compiled, the volatile functions returning other
+/// values on the first run, and the entity records are only left out of the cache when they differ between the two.
+/// The script is parsed once per change only: its bytecode is dumped next to the compiled file, and loaded instead of
+/// the source by the next runs.
+/// @file LevelCompiler.h
+/// @author Maxime Héliot
+/// @version 0.1.0 18/10/2026
+class LevelCompiler {
+private:
+    /// String object representing the directory holding the compiled level files.
+    std::string directory;
+
+    /// @brief Load a level script
+    /// @details Load the bytecode file of the script when dumped from the same script by the same Lua version and
+    /// its payload matches the hash it was written with, parse the script and dump its bytecode otherwise.
+    /// @param script: The content of the script file.
+    /// @param scriptPath: The path of the script file, used as chunk name and in the error messages.
+    /// @param scriptHash: Integer value representing the hash of the script, keying the bytecode file.
+    /// @param bytecodePath: The path of the bytecode file.
+    /// @return The loaded chunk, invalid on syntax errors.
+    sol::protected_function LoadScript(sol::state& lua, const std::string& script, const std::string& scriptPath,
+                                       std::uint64_t scriptHash, const std::string& bytecodePath) const;
+
+    /// @brief Run a loaded level script
+    /// @param chunk: The loaded chunk of the script.
+    /// @param isVolatile: Pointer receiving whether the script read the time or random numbers, nullptr not to track it.
+    /// @param isShifted: Boolean value making the tracked time and random functions return other values than usual.
+    /// @return A boolean value representing the success status of the script.
+    static bool RunScript(sol::state& lua, const sol::protected_function& chunk, bool* isVolatile, bool isShifted);
+
+    /// @brief Read the level assets, tilemap and music from the Lua level table
+    static void ReadLevelHeader(const sol::table& levelTable, LevelDescription& level);
+
+    /// @brief Read the level entities from the Lua level table
+    static void ReadLevelEntities(const sol::table& levelTable, LevelDescription& level);
+
+    /// @brief Read a compiled level file
+    /// @return A boolean value representing the validity of the file for the given script hash.
+    static bool ReadCompiledLevel(const std::string& filePath, std::uint64_t scriptHash, LevelDescription& level);
+
+    /// @brief Write a compiled level file
+    void WriteCompiledLevel(const std::string& filePath, std::uint64_t scriptHash, const LevelDescription& level) const;
+
+    /// @brief Write a file of the cache directory
+    /// @details Written through a temporary file so that a concurrent reader never sees a partial file.
+    void WriteCacheFile(const std::string& filePath, const std::string& buffer) const;
+
+public:
+    /// @brief Default LevelCompiler constructor
+    /// @details Base constructor of the LevelCompiler class.
+    /// @param directory: The directory holding the compiled level files, created on the first write.
+    explicit LevelCompiler(std::string directory = "./cache");
+
+    /// @brief Compile a level
+    /// @details This method is responsible for filling the description of the given level, from its compiled file
+    /// when up to date, from its script otherwise, compiling it meanwhile. Leaves the Level table in the Lua state
+    /// whenever the description needs it.
+    /// @param levelNumber: Integer value representing the index of the level to compile.
+    /// @param level: LevelDescription object to fill.
+    /// @return A boolean value representing the success status of the compilation.
+    bool Compile(sol::state& lua, int levelNumber, LevelDescription& level) const;
+
+    /// @brief Run a level script
+    /// @details This method is responsible for running the script of the given level in another Lua state, leaving
+    /// its Level table there without compiling it. The bytecode file is shared with the compilation.
+    /// @param levelNumber: Integer value representing the index of the level to run.
+    /// @return A boolean value representing the success status of the script.
+    bool RunLevelScript(sol::state& lua, int levelNumber) const;
+
+    /// @brief Level script path getter
+    /// @param levelNumber: Integer value representing the index of the level.
+    /// @return The path of the Lua script of the level.
+    static std::string GetScriptPath(int levelNumber);
+};
+
+#endif // LEVELCOMPILER_H //
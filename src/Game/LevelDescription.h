@@ -0,0 +1,187 @@
+#ifndef LEVELDESCRIPTION_H
+#define LEVELDESCRIPTION_H
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/// Enumeration of the component records an entity description can hold, one bit per component.
+enum LevelComponentFlag: std::uint32_t {
+    LEVEL_COMPONENT_TRANSFORM = 1 << 0,
+    LEVEL_COMPONENT_RIGIDBODY = 1 << 1,
+    LEVEL_COMPONENT_SPRITE = 1 << 2,
+    LEVEL_COMPONENT_ANIMATION = 1 << 3,
+    LEVEL_COMPONENT_BOXCOLLIDER = 1 << 4,
+    LEVEL_COMPONENT_HEALTH = 1 << 5,
+    LEVEL_COMPONENT_PROJECTILE_EMITTER = 1 << 6,
+    LEVEL_COMPONENT_SOUND_EMITTER = 1 << 7,
+    LEVEL_COMPONENT_CAMERA_FOLLOW = 1 << 8,
+    LEVEL_COMPONENT_KEYBOARD_CONTROLLED = 1 << 9,
+    LEVEL_COMPONENT_SCRIPT = 1 << 10,
+    LEVEL_COMPONENT_SINE_MOTION = 1 << 11,
+    LEVEL_COMPONENT_PATROL_BOUNDS = 1 << 12,
+    LEVEL_COMPONENT_FACE_VELOCITY = 1 << 13,
+    LEVEL_COMPONENT_SCRIPT_EVENT_HANDLER = 1 << 14
+};
+
+/// Structure holding an asset declared by a level.
+struct LevelAssetDescription {
+    /// String object representing the type of the asset: "texture", "font", "sound" or "music".
+    std::string type;
+    /// String object representing the id of the asset.
+    std::string id;
+    /// String object representing the path of the asset file.
+    std::string filePath;
+    /// Integer value representing the size of the font, for the font assets only.
+    int fontSize = 0;
+};
+
+/// Structure holding the tilemap of a level.
+struct LevelTilemapDescription {
+    /// String object representing the path of the map file.
+    std::string mapFilePath;
+    /// String object representing the id of the texture holding the tiles.
+    std::string textureAssetId;
+    /// Integer value representing the number of rows of the map.
+    int numRows = 0;
+    /// Integer value representing the number of columns of the map.
+    int numCols = 0;
+    /// Integer value representing the size of a tile in the texture, in pixels.
+    int tileSize = 0;
+    /// Integer value representing the number of tiles per row of the texture, tile ids being counted row by row.
+    int tilesPerRow = 10;
+    /// Double value representing the scale the tiles are drawn at.
+    double scale = 1.0;
+};
+
+/// Structure holding an entity of a level as the arguments of its component constructors.
+/// @details Only the records flagged in components are meaningful. The script functions are not part of the
+/// description, they are fetched from the Lua level table by the index of the entity.
+/// @file LevelDescription.h
+/// @author Maxime Héliot
+/// @version 0.1.0 18/10/2026
+struct LevelEntityDescription {
+    /// String object representing the tag of the entity, empty if untagged.
+    std::string tag;
+    /// String object representing the group of the entity, empty if not grouped.
+    std::string group;
+    /// Integer value representing the LevelComponentFlag bits of the components of the entity.
+    std::uint32_t components = 0;
+
+    /// Structure holding the arguments of the TransformComponent.
+    struct {
+        glm::vec2 position = glm::vec2(0.0);
+        glm::vec2 scale = glm::vec2(1.0);
+        glm::vec2 rotation = glm::vec2(0.0);
+    } transform;
+
+    /// Structure holding the arguments of the RigidBodyComponent.
+    struct {
+        glm::vec2 velocity = glm::vec2(0.0);
+    } rigidbody;
+
+    /// Structure holding the arguments of the SpriteComponent.
+    struct {
+        std::string assetId;
+        int width = 0;
+        int height = 0;
+        int zIndex = 1;
+        bool isFixed = false;
+        int srcRectX = 0;
+        int srcRectY = 0;
+    } sprite;
+
+    /// Structure holding the arguments of the AnimationComponent.
+    struct {
+        int numFrames = 1;
+        int frameSpeedRate = 1;
+    } animation;
+
+    /// Structure holding the arguments of the BoxColliderComponent.
+    struct {
+        int width = 0;
+        int height = 0;
+        glm::vec2 offset = glm::vec2(0.0);
+    } boxCollider;
+
+    /// Structure holding the arguments of the HealthComponent.
+    struct {
+        int healthPercentage = 100;
+    } health;
+
+    /// Structure holding the arguments of the ProjectileEmitterComponent, durations in milliseconds.
+    struct {
+        glm::vec2 projectileVelocity = glm::vec2(0.0);
+        int repeatFrequency = 1000;
+        int projectileDuration = 10000;
+        int hitPercentDamage = 10;
+        bool isFriendly = false;
+        std::string soundAssetId;
+        int soundPriority = 1;
+    } projectileEmitter;
+
+    /// Structure holding the arguments of the SoundEmitterComponent.
+    struct {
+        std::string assetId;
+        int priority = 1;
+        int volume = 128;
+    } soundEmitter;
+
+    /// Structure holding the arguments of the KeyboardControlledComponent.
+    struct {
+        glm::vec2 upVelocity = glm::vec2(0.0);
+        glm::vec2 rightVelocity = glm::vec2(0.0);
+        glm::vec2 downVelocity = glm::vec2(0.0);
+        glm::vec2 leftVelocity = glm::vec2(0.0);
+    } keyboardControlled;
+
+    /// Structure holding the arguments of the SineMotionComponent.
+    struct {
+        glm::vec2 origin = glm::vec2(0.0);
+        glm::vec2 velocity = glm::vec2(0.0);
+        glm::vec2 amplitude = glm::vec2(0.0);
+        glm::vec2 frequency = glm::vec2(0.0);
+        glm::vec2 phase = glm::vec2(0.0);
+    } sineMotion;
+
+    /// Structure holding the arguments of the PatrolBoundsComponent.
+    struct {
+        glm::vec2 nearMargin = glm::vec2(0.0);
+        glm::vec2 farMargin = glm::vec2(0.0);
+    } patrolBounds;
+
+    /// Structure holding the arguments of the FaceVelocityComponent.
+    struct {
+        double angleOffset = 0.0;
+        bool isAimingProjectiles = false;
+    } faceVelocity;
+
+    /// Structure holding the arguments of the ScriptComponent, but its function.
+    struct {
+        bool isBatched = false;
+        double interval = 0.0;
+        bool isCoroutine = false;
+        bool isPure = false;
+    } script;
+};
+
+/// Structure holding everything a level declares, as evaluated from its Lua script.
+struct LevelDescription {
+    /// Vector of the assets of the level, in declaration order.
+    std::vector<LevelAssetDescription> assets;
+    /// LevelTilemapDescription object holding the tilemap of the level.
+    LevelTilemapDescription tilemap;
+    /// String object representing the id of the music asset played by the level, empty if none.
+    std::string musicAssetId;
+    /// Vector of the entities of the level, in declaration order.
+    std::vector<LevelEntityDescription> entities;
+    /// Boolean value representing the need of the Lua level table to fetch the script functions of the entities.
+    bool hasScripts = false;
+    /// Boolean value representing the use, by the script, of values changing between two runs such as the time.
+    bool isVolatile = false;
+    /// Boolean value representing entities depending on those values, not cached but read again on every run.
+    bool hasVolatileEntities = false;
+};
+
+#endif // LEVELDESCRIPTION_H //
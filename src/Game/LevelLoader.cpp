@@ -1,5 +1,6 @@
 #include "./LevelLoader.h"
 #include "./Game.h"
+#include "./LevelCompiler.h"
 #include "../Components/TransformComponent.h"
 #include "../Components/RigidBodyComponent.h"
 #include "../Components/SpriteComponent.h"
@@ -10,7 +11,16 @@
 #include "../Components/ProjectileEmitterComponent.h"
 #include "../Components/HealthComponent.h"
 #include "../Components/ScriptComponent.h"
-#include <fstream>
+#include "../Components/SoundEmitterComponent.h"
+#include "../Components/SineMotionComponent.h"
+#include "../Components/PatrolBoundsComponent.h"
+#include "../Components/FaceVelocityComponent.h"
+#include "../Components/ScriptEventHandlerComponent.h"
+#include "../Systems/AudioSystem.h"
+#include "../AssetStore/Tilemap.h"
+#include "../Streaming/WorldStreamer.h"
+#include <algorithm>
+#include <future>
 #include <string>
 #include <sol/sol.hpp>
 
@@ -22,236 +32,230 @@ LevelLoader::~LevelLoader() {
     Logger::Log("LevelLoader constructor destructed!");
 }
 
-void LevelLoader::LoadLevel(sol::state& lua, const std::unique_ptr<Registry>& registry, const std::unique_ptr<AssetStore>& assetStore, SDL_Renderer* renderer, int levelNumber) {
-    sol::load_result script = lua.load_file("./../assets/scripts/Level" + std::to_string(levelNumber) + ".lua");
-
-    // This checks the syntax of our script, but it does not execute the script
-    if (!script.valid()) {
-        sol::error err = script;
-        std::string errorMessage = err.what();
-        Logger::Err("Error loading the lua script: " + errorMessage);
+void LevelLoader::LoadLevel(sol::state& lua, const std::unique_ptr<Registry>& registry, const std::unique_ptr<AssetStore>& assetStore, SDL_Renderer* renderer, int levelNumber,
+                            WorldStreamer* worldStreamer) {
+    // Read the level from its compiled file, the Lua script only runs when changed or when its functions are needed
+    LevelDescription level;
+    LevelCompiler compiler;
+    levelFiles.clear();
+    numPureScripts = 0;
+    if (!compiler.Compile(lua, levelNumber, level)) {
         return;
     }
-
-    // Executes the script using the Sol state
-    lua.script_file("./../assets/scripts/Level" + std::to_string(levelNumber) + ".lua");
-    Logger::Log("We just opened the Level1.lua");
-
-    // Read the big table for the current level
-    sol::table level = lua["Level"];
+    levelFiles = {LevelCompiler::GetScriptPath(levelNumber), level.tilemap.mapFilePath};
+    numPureScripts = static_cast<std::size_t>(std::count_if(level.entities.begin(), level.entities.end(), [](const LevelEntityDescription& entity) {
+        return (entity.components & LEVEL_COMPONENT_SCRIPT) && entity.script.isPure;
+    }));
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // Read the level assets
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    sol::table assets = level["assets"];
+    // Anything the previous level declared and this one does not is released once unreferenced
+    assetStore->BeginLevel();
 
-    int i = 0;
-    // Loop all entries
-    while(true) {
-        sol::optional<sol::table> hasAsset = assets[i];
-        if (hasAsset == sol::nullopt) {
-            break;
+    // Decode the images and open the fonts on the worker pool while the rest of the level gets instantiated
+    assetStore->BeginLoadBatch();
+    for (const auto& asset: level.assets) {
+        if (asset.type == "texture") {
+            assetStore->AddTextureAsync(renderer, asset.id, asset.filePath);
+            Logger::Log("A new texture asset was queued to the asset store, id: " + asset.id);
+        } else if (asset.type == "font") {
+            assetStore->AddFontAsync(asset.id, asset.filePath, asset.fontSize);
+            Logger::Log("A new font asset was queued to the asset store, id: " + asset.id);
+        } else if (asset.type == "sound") {
+            assetStore->AddSound(asset.id, asset.filePath);
+            Logger::Log("A new sound asset was added to the asset store, id: " + asset.id);
+        } else if (asset.type == "music") {
+            assetStore->AddMusic(asset.id, asset.filePath);
+            Logger::Log("A new music asset was added to the asset store, id: " + asset.id);
         }
-
-        sol::table asset = assets[i];
-        std::string assetType = asset["type"];
-        std::string assetId = asset["id"];
-        if (assetType == "texture") {
-            assetStore->AddTexture(renderer, assetId, asset["file"]);
-            Logger::Log("A new texture asset was added to the asset store, id: " + assetId);
-        } else if (assetType == "font") {
-            assetStore->AddFont(assetId, asset["file"], asset["font_size"]);
-            Logger::Log("A new font asset was added to the asset store, id: " + assetId);
-        }
-        i++;
     }
+    std::future<void> assetsLoaded = assetStore->EndLoadBatch();
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // Read the level tilemap information
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    sol::table map = level["tilemap"];
-    std::string mapFilePath = map["map_file"];
-    std::string mapTextureAssetId = map["texture_asset_id"];
-
-    int mapNumRows = map["num_rows"];
-    int mapNumCols = map["num_cols"];
-    int tileSize = map["tile_size"];
-    double mapScale = map["scale"];
+    const std::string& mapFilePath = level.tilemap.mapFilePath;
+    const std::string& mapTextureAssetId = level.tilemap.textureAssetId;
+    const int mapNumRows = level.tilemap.numRows;
+    const int mapNumCols = level.tilemap.numCols;
+    const int tileSize = level.tilemap.tileSize;
+    const double mapScale = level.tilemap.scale;
 
-    std::fstream mapFile;
-    mapFile.open(mapFilePath);
-    for (int y = 0; y < mapNumRows; y++) {
-        for (int x = 0; x < mapNumCols; x++) {
-            char ch;
-            mapFile.get(ch);
-            int srcRectY = std::atoi(&ch) * tileSize;
-            mapFile.get(ch);
-            int srcRectX = std::atoi(&ch) * tileSize;
-            mapFile.ignore();
+    // Read the map from the asset archive when packed, from its own file otherwise
+    Tilemap tilemap;
+    std::size_t archivedMapSize = 0;
+    const char* archivedMap = assetStore->GetArchivedFile(mapFilePath, archivedMapSize);
+    const bool isMapLoaded = archivedMap
+            ? tilemap.LoadFromMemory(reinterpret_cast<const unsigned char*>(archivedMap), archivedMapSize)
+            : tilemap.LoadFromFile(mapFilePath);
+    if (!isMapLoaded) {
+        Logger::Err("Error loading the tilemap " + mapFilePath + ": " + tilemap.GetError());
+    } else if (!tilemap.HasSize(mapNumRows, mapNumCols)) {
+        Logger::Err("The tilemap " + mapFilePath + " has " + std::to_string(tilemap.GetNumRows()) + "x" +
+                    std::to_string(tilemap.GetNumCols()) + " tiles instead of " + std::to_string(mapNumRows) + "x" +
+                    std::to_string(mapNumCols));
+    } else if (!worldStreamer) {
+        const int tilesPerRow = std::max(level.tilemap.tilesPerRow, 1);
+        for (int y = 0; y < mapNumRows; y++) {
+            for (int x = 0; x < mapNumCols; x++) {
+                const int tileId = tilemap.GetTile(x, y);
+                const int srcRectY = tileId / tilesPerRow * tileSize;
+                const int srcRectX = tileId % tilesPerRow * tileSize;
 
-            Entity tile = registry->CreateEntity();
-            tile.AddComponent<TransformComponent>(glm::vec2(x * (mapScale * tileSize), y * (mapScale * tileSize)), glm::vec2(mapScale, mapScale), glm::vec2(0.0, 0.0));
-            tile.AddComponent<SpriteComponent>(mapTextureAssetId, tileSize, tileSize, 0, false, srcRectX, srcRectY);
+                Entity tile = registry->CreateEntity();
+                tile.AddComponent<TransformComponent>(glm::vec2(x * (mapScale * tileSize), y * (mapScale * tileSize)), glm::vec2(mapScale, mapScale), glm::vec2(0.0, 0.0));
+                tile.AddComponent<SpriteComponent>(mapTextureAssetId, tileSize, tileSize, 0, false, srcRectX, srcRectY);
+            }
         }
     }
-    mapFile.close();
     Game::mapWidth = mapNumCols * tileSize * mapScale;
     Game::mapHeight = mapNumRows * tileSize * mapScale;
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    // Read the level entities and components
+    // Instantiate the level entities and components
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    sol::table entities = level["entities"];
-    i = 0;
-    while (true) {
-        sol::optional<sol::table> hasEntity = entities[i];
-        if (hasEntity == sol::nullopt) {
-            break;
-        }
-
-        sol::table entity = entities[i];
-        Entity newEntity = registry->CreateEntity();
+    sol::optional<sol::table> scriptedEntities;
+    if (level.hasScripts) {
+        scriptedEntities = lua["Level"]["entities"];
+    }
 
-        // Tag
-        sol::optional<std::string> tag = entity["tag"];
-        if (tag != sol::nullopt) {
-            newEntity.Tag(entity["tag"]);
+    std::vector<LevelEntityDescription> streamedEntities;
+    std::vector<LevelEntityScripts> streamedEntityScripts;
+    for (std::size_t i = 0; i < level.entities.size(); i++) {
+        const LevelEntityDescription& entity = level.entities[i];
+        LevelEntityScripts scripts;
+        scripts.levelEntityIndex = static_cast<int>(i);
+        if ((entity.components & (LEVEL_COMPONENT_SCRIPT | LEVEL_COMPONENT_SCRIPT_EVENT_HANDLER)) && scriptedEntities != sol::nullopt) {
+            sol::table components = scriptedEntities.value()[i]["components"];
+            if (entity.components & LEVEL_COMPONENT_SCRIPT) {
+                scripts.onUpdate = components["on_update_script"][0];
+            }
+            if (entity.components & LEVEL_COMPONENT_SCRIPT_EVENT_HANDLER) {
+                scripts.onCollision = components["on_collision"].get_or<sol::function>(sol::lua_nil);
+                scripts.onKilled = components["on_killed"].get_or<sol::function>(sol::lua_nil);
+            }
         }
 
-        // Group
-        sol::optional<std::string> group = entity["group"];
-        if (group != sol::nullopt) {
-            newEntity.Group(entity["group"]);
+        // Anything placed in the world and not singled out by a tag, the camera or the controls can be streamed
+        const bool isStreamed = worldStreamer && entity.tag.empty() &&
+                (entity.components & LEVEL_COMPONENT_TRANSFORM) &&
+                !(entity.components & (LEVEL_COMPONENT_CAMERA_FOLLOW | LEVEL_COMPONENT_KEYBOARD_CONTROLLED)) &&
+                !((entity.components & LEVEL_COMPONENT_SPRITE) && entity.sprite.isFixed);
+        if (isStreamed) {
+            streamedEntities.push_back(entity);
+            streamedEntityScripts.push_back(scripts);
+        } else {
+            CreateEntity(*registry, entity, scripts);
         }
+    }
 
-        // Components
-        sol::optional<sol::table> hasComponents = entity["components"];
-        if (hasComponents != sol::nullopt) {
-            // Transform
-            sol::optional<sol::table> transform = entity["components"]["transform"];
-            if (transform != sol::nullopt) {
-                newEntity.AddComponent<TransformComponent>(
-                        glm::vec2(
-                                entity["components"]["transform"]["position"]["x"],
-                                entity["components"]["transform"]["position"]["y"]
-                        ),
-                        glm::vec2(
-                                entity["components"]["transform"]["scale"]["x"].get_or(1.0),
-                                entity["components"]["transform"]["scale"]["y"].get_or(1.0)
-                        ),
-                        glm::vec2(
-                                entity["components"]["transform"]["rotation"]["x"].get_or(0.0),
-                                entity["components"]["transform"]["rotation"]["y"].get_or(0.0)
-                        )
-                );
-            }
-
-            // RigidBody
-            sol::optional<sol::table> rigidbody = entity["components"]["rigidbody"];
-            if (rigidbody != sol::nullopt) {
-                newEntity.AddComponent<RigidBodyComponent>(
-                        glm::vec2(
-                                entity["components"]["rigidbody"]["velocity"]["x"].get_or(0.0),
-                                entity["components"]["rigidbody"]["velocity"]["y"].get_or(0.0)
-                        )
-                );
-            }
-
-            // Sprite
-            sol::optional<sol::table> sprite = entity["components"]["sprite"];
-            if (sprite != sol::nullopt) {
-                newEntity.AddComponent<SpriteComponent>(
-                        entity["components"]["sprite"]["texture_asset_id"],
-                        entity["components"]["sprite"]["width"],
-                        entity["components"]["sprite"]["height"],
-                        entity["components"]["sprite"]["z_index"].get_or(1),
-                        entity["components"]["sprite"]["fixed"].get_or(false),
-                        entity["components"]["sprite"]["src_rect_x"].get_or(0),
-                        entity["components"]["sprite"]["src_rect_y"].get_or(0)
-                        );
-            }
+    if (worldStreamer) {
+        worldStreamer->SetWorld(isMapLoaded && tilemap.HasSize(mapNumRows, mapNumCols) ? std::move(tilemap) : Tilemap(),
+                                level.tilemap, std::move(streamedEntities), std::move(streamedEntityScripts));
+    }
 
-            // Animation
-            sol::optional<sol::table> animation = entity["components"]["animation"];
-            if (animation != sol::nullopt) {
-                newEntity.AddComponent<AnimationComponent>(
-                        entity["components"]["animation"]["num_frames"].get_or(1),
-                        entity["components"]["animation"]["speed_rate"].get_or(1)
-                );
-            }
+    // Start the level music, if any
+    if (!level.musicAssetId.empty() && registry->HasSystem<AudioSystem>()) {
+        registry->GetSystem<AudioSystem>().PlayMusic(assetStore->GetMusic(level.musicAssetId));
+    }
 
-            // BoxCollider
-            sol::optional<sol::table> collider = entity["components"]["boxcollider"];
-            if (collider != sol::nullopt) {
-                newEntity.AddComponent<BoxColliderComponent>(
-                        entity["components"]["boxcollider"]["width"],
-                        entity["components"]["boxcollider"]["height"],
-                        glm::vec2(
-                                entity["components"]["boxcollider"]["offset"]["x"].get_or(0),
-                                entity["components"]["boxcollider"]["offset"]["y"].get_or(0)
-                        )
-                );
-            }
+    // Upload every texture of the level in one batch once the workers are done
+    assetsLoaded.wait();
+    assetStore->UploadLoadedAssets(renderer);
+}
 
-            // Health
-            sol::optional<sol::table> health = entity["components"]["health"];
-            if (health != sol::nullopt) {
-                newEntity.AddComponent<HealthComponent>(
-                        static_cast<int>(entity["components"]["health"]["health_percentage"].get_or(100))
-                );
-            }
+Entity LevelLoader::CreateEntity(Registry& registry, const LevelEntityDescription& entity, const LevelEntityScripts& scripts) {
+    Entity newEntity = registry.CreateEntity();
 
-            // ProjectileEmitter
-            sol::optional<sol::table> projectileEmitter = entity["components"]["projectile_emitter"];
-            if (projectileEmitter != sol::nullopt) {
-                newEntity.AddComponent<ProjectileEmitterComponent>(
-                        glm::vec2(
-                                entity["components"]["projectile_emitter"]["projectile_velocity"]["x"],
-                                entity["components"]["projectile_emitter"]["projectile_velocity"]["y"]
-                        ),
-                        static_cast<int>(entity["components"]["projectile_emitter"]["repeat_frequency"].get_or(1)) * 1000,
-                        static_cast<int>(entity["components"]["projectile_emitter"]["projectile_duration"].get_or(10)) * 1000,
-                        static_cast<int>(entity["components"]["projectile_emitter"]["hit_percentage_damage"].get_or(10)),
-                        entity["components"]["projectile_emitter"]["friendly"].get_or(false)
-                );
-            }
+    if (!entity.tag.empty()) {
+        newEntity.Tag(entity.tag);
+    }
+    if (!entity.group.empty()) {
+        newEntity.Group(entity.group);
+    }
 
-            // CameraFollow
-            sol::optional<sol::table> cameraFollow = entity["components"]["camera_follow"];
-            if (cameraFollow != sol::nullopt) {
-                newEntity.AddComponent<CameraFollowComponent>();
-            }
+    const std::uint32_t components = entity.components;
+    if (components & LEVEL_COMPONENT_TRANSFORM) {
+        newEntity.AddComponent<TransformComponent>(entity.transform.position, entity.transform.scale, entity.transform.rotation);
+    }
+    if (components & LEVEL_COMPONENT_RIGIDBODY) {
+        newEntity.AddComponent<RigidBodyComponent>(entity.rigidbody.velocity);
+    }
+    if (components & LEVEL_COMPONENT_SPRITE) {
+        newEntity.AddComponent<SpriteComponent>(
+                entity.sprite.assetId,
+                entity.sprite.width,
+                entity.sprite.height,
+                entity.sprite.zIndex,
+                entity.sprite.isFixed,
+                entity.sprite.srcRectX,
+                entity.sprite.srcRectY
+        );
+    }
+    if (components & LEVEL_COMPONENT_ANIMATION) {
+        newEntity.AddComponent<AnimationComponent>(entity.animation.numFrames, entity.animation.frameSpeedRate);
+    }
+    if (components & LEVEL_COMPONENT_BOXCOLLIDER) {
+        newEntity.AddComponent<BoxColliderComponent>(entity.boxCollider.width, entity.boxCollider.height, entity.boxCollider.offset);
+    }
+    if (components & LEVEL_COMPONENT_HEALTH) {
+        newEntity.AddComponent<HealthComponent>(entity.health.healthPercentage);
+    }
+    if (components & LEVEL_COMPONENT_PROJECTILE_EMITTER) {
+        newEntity.AddComponent<ProjectileEmitterComponent>(
+                entity.projectileEmitter.projectileVelocity,
+                entity.projectileEmitter.repeatFrequency,
+                entity.projectileEmitter.projectileDuration,
+                entity.projectileEmitter.hitPercentDamage,
+                entity.projectileEmitter.isFriendly,
+                entity.projectileEmitter.soundAssetId,
+                entity.projectileEmitter.soundPriority
+        );
+    }
+    if (components & LEVEL_COMPONENT_SOUND_EMITTER) {
+        newEntity.AddComponent<SoundEmitterComponent>(entity.soundEmitter.assetId, entity.soundEmitter.priority, entity.soundEmitter.volume);
+    }
+    if (components & LEVEL_COMPONENT_CAMERA_FOLLOW) {
+        newEntity.AddComponent<CameraFollowComponent>();
+    }
+    if (components & LEVEL_COMPONENT_KEYBOARD_CONTROLLED) {
+        newEntity.AddComponent<KeyboardControlledComponent>(
+                entity.keyboardControlled.upVelocity,
+                entity.keyboardControlled.rightVelocity,
+                entity.keyboardControlled.downVelocity,
+                entity.keyboardControlled.leftVelocity
+        );
+    }
+    if (components & LEVEL_COMPONENT_SINE_MOTION) {
+        newEntity.AddComponent<SineMotionComponent>(
+                entity.sineMotion.origin,
+                entity.sineMotion.velocity,
+                entity.sineMotion.amplitude,
+                entity.sineMotion.frequency,
+                entity.sineMotion.phase
+        );
+    }
+    if (components & LEVEL_COMPONENT_PATROL_BOUNDS) {
+        newEntity.AddComponent<PatrolBoundsComponent>(entity.patrolBounds.nearMargin, entity.patrolBounds.farMargin);
+    }
+    if (components & LEVEL_COMPONENT_FACE_VELOCITY) {
+        newEntity.AddComponent<FaceVelocityComponent>(entity.faceVelocity.angleOffset, entity.faceVelocity.isAimingProjectiles);
+    }
+    if ((components & LEVEL_COMPONENT_SCRIPT) && scripts.onUpdate.valid()) {
+        newEntity.AddComponent<ScriptComponent>(scripts.onUpdate, entity.script.isBatched, entity.script.interval, entity.script.isCoroutine,
+                                                entity.script.isPure, scripts.levelEntityIndex);
+    }
+    if ((components & LEVEL_COMPONENT_SCRIPT_EVENT_HANDLER) && (scripts.onCollision.valid() || scripts.onKilled.valid())) {
+        newEntity.AddComponent<ScriptEventHandlerComponent>(scripts.onCollision, scripts.onKilled);
+    }
+    return newEntity;
+}
 
-            // KeyboardControlled
-            sol::optional<sol::table> keyboardControlled = entity["components"]["keyboard_controller"];
-            if (keyboardControlled != sol::nullopt) {
-                newEntity.AddComponent<KeyboardControlledComponent>(
-                        glm::vec2(
-                                entity["components"]["keyboard_controller"]["up_velocity"]["x"],
-                                entity["components"]["keyboard_controller"]["up_velocity"]["y"]
-                        ),
-                        glm::vec2(
-                                entity["components"]["keyboard_controller"]["right_velocity"]["x"],
-                                entity["components"]["keyboard_controller"]["right_velocity"]["y"]
-                        ),
-                        glm::vec2(
-                                entity["components"]["keyboard_controller"]["down_velocity"]["x"],
-                                entity["components"]["keyboard_controller"]["down_velocity"]["y"]
-                        ),
-                        glm::vec2(
-                                entity["components"]["keyboard_controller"]["left_velocity"]["x"],
-                                entity["components"]["keyboard_controller"]["left_velocity"]["y"]
-                        )
-                );
-            }
+const std::vector<std::string>& LevelLoader::GetLevelFiles() const {
+    return levelFiles;
+}
 
-            // Script
-            sol::optional<sol::table> script = entity["components"]["on_update_script"];
-            if (script != sol::nullopt) {
-                sol::function func = entity["components"]["on_update_script"][0];
-                newEntity.AddComponent<ScriptComponent>(func);
-            }
-        }
-        i++;
-    }
+std::size_t LevelLoader::GetNumPureScripts() const {
+    return numPureScripts;
 }
@@ -3,12 +3,37 @@
 
 #include "../ECS/ECS.h"
 #include "../AssetStore/AssetStore.h"
+#include "./LevelDescription.h"
 #include <SDL.h>
 #include <sol/sol.hpp>
+#include <cstddef>
 #include <memory>
+#include <string>
+#include <vector>
+
+class WorldStreamer;
+
+/// Structure holding the Lua functions of an entity of a level, nil for the ones it does not declare.
+struct LevelEntityScripts {
+    /// The update script function, for the script component.
+    sol::function onUpdate = sol::lua_nil;
+    /// The collision handler, for the script event handler component.
+    sol::function onCollision = sol::lua_nil;
+    /// The kill handler, for the script event handler component.
+    sol::function onKilled = sol::lua_nil;
+    /// Integer value representing the index of the entity in the Level table, where the worker Lua states fetch
+    /// the pure update scripts from.
+    int levelEntityIndex = -1;
+};
 
 /// TODO: comments
 class LevelLoader {
+private:
+    /// Vector of the paths of the files the level was loaded from: its script and its tilemap.
+    std::vector<std::string> levelFiles;
+    /// Integer value representing the number of pure update scripts of the level.
+    std::size_t numPureScripts = 0;
+
 public:
     /// TODO: comments
     LevelLoader();
@@ -19,7 +44,26 @@ public:
     /// @brief Load level method
     /// @details This method is responsible for loading the different element constituting of the targeted level.
     /// @param level: Integer value representing the index of the level scene to load.
-    void LoadLevel(sol::state& lua, const std::unique_ptr<Registry>& registry, const std::unique_ptr<AssetStore>& assetStore, SDL_Renderer* renderer, int levelNumber);
+    /// @param worldStreamer: World streamer to hand the tiles and the entities placed in the world to, instead of
+    /// creating them up front, nullptr to create the whole level.
+    void LoadLevel(sol::state& lua, const std::unique_ptr<Registry>& registry, const std::unique_ptr<AssetStore>& assetStore, SDL_Renderer* renderer, int levelNumber,
+                   WorldStreamer* worldStreamer = nullptr);
+
+    /// @brief Create entity method
+    /// @details This method is responsible for creating an entity with the components of the given description.
+    /// @param entity: LevelEntityDescription object holding the tag, group and components of the entity.
+    /// @param scripts: The Lua functions of the entity, used when the description has a script or a script event handler
+    /// component.
+    /// @return The Entity object created.
+    static Entity CreateEntity(Registry& registry, const LevelEntityDescription& entity, const LevelEntityScripts& scripts);
+
+    /// @brief Level files getter
+    /// @return The paths of the script and tilemap files of the last level loaded, empty if it failed to compile.
+    const std::vector<std::string>& GetLevelFiles() const;
+
+    /// @brief Pure scripts number getter
+    /// @return The number of entities of the last level loaded with a pure update script.
+    std::size_t GetNumPureScripts() const;
 };
 
 #endif // LEVELLOADER_H //
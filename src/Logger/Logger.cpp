@@ -3,10 +3,14 @@
 #include <string>
 #include <chrono>
 #include <ctime>
+#include <mutex>
 
 // a static member variable need to be defined before use it.
 std::vector<LogEntry> Logger::messages;
 
+// Systems may log from the simulation thread while the main thread renders
+static std::mutex messagesMutex;
+
 std::string CurrentDateTimeToString() {
     // "_t" means it comes from a C data type
     std::time_t now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
@@ -20,6 +24,7 @@ void Logger::Log(const std::string &message) {
     logEntry.type = LOG_INFO;
     logEntry.message = "LOG: [" + CurrentDateTimeToString() + "]: " + message;
 
+    std::lock_guard<std::mutex> lock(messagesMutex);
     std::cout << "\x1B[32m" << logEntry.message << "\033[0m" << std::endl;
 
     messages.push_back(logEntry);
@@ -30,6 +35,7 @@ void Logger::Err(const std::string &message) {
     logEntry.type = LOG_ERROR;
     logEntry.message = "ERR: [" + CurrentDateTimeToString() + "]: " + message;
 
+    std::lock_guard<std::mutex> lock(messagesMutex);
     std::cout << "\x1B[91m" << logEntry.message << "\033[0m" << std::endl;
 
     messages.push_back(logEntry);
@@ -1,11 +1,72 @@
 #include "Game/Game.h"
+#include "Scripting/ScriptProfiler.h"
+#include "Logger/Logger.h"
 #include <sol/sol.hpp>
 #include <iostream>
+#include <string>
+#include <cctype>
+#include <cstdlib>
+#include <climits>
+
+/// @brief Parse a strictly positive integer, the whole argument being digits.
+static bool ReadPositiveInteger(const char* argument, int& value) {
+    char* end = nullptr;
+    const long number = std::strtol(argument, &end, 10);
+    if (end == argument || *end != '\0' || number <= 0 || number > INT_MAX) {
+        return false;
+    }
+    value = static_cast<int>(number);
+    return true;
+}
 
 int main(int argc, char* argv[])
 {
     Game game;
 
+    for (int i = 1; i < argc; i++) {
+        std::string argument = argv[i];
+        if (argument == "--pipelined") {
+            game.SetPipelined(true);
+        }
+        if (argument == "--headless") {
+            // Optionally followed by the number of ticks to simulate
+            int numTicks = 1000;
+            if (i + 1 < argc && std::isdigit(static_cast<unsigned char>(argv[i + 1][0]))) {
+                numTicks = std::atoi(argv[++i]);
+            }
+            game.SetHeadless(numTicks);
+        }
+        if (argument == "--lazy-textures") {
+            game.SetTextureLoadMode(TEXTURE_LOAD_ON_FIRST_USE);
+        }
+        if (argument == "--lazy-textures-async") {
+            game.SetTextureLoadMode(TEXTURE_LOAD_ASYNC_PLACEHOLDER);
+        }
+        if (argument == "--no-image-cache") {
+            game.SetImageCacheEnabled(false);
+        }
+        if (argument == "--hot-reload") {
+            game.SetHotReloadEnabled(true);
+        }
+        if (argument == "--stream-world") {
+            game.SetWorldStreamed(true);
+        }
+        if (argument == "--profile-scripts") {
+            // Optionally followed by the number of Lua instructions between two call stack samples
+            int sampleInstructionCount = DEFAULT_SCRIPT_PROFILER_SAMPLE_COUNT;
+            if (i + 1 < argc && std::string(argv[i + 1]).rfind("--", 0) != 0 &&
+                !ReadPositiveInteger(argv[++i], sampleInstructionCount)) {
+                Logger::Err("--profile-scripts expects a positive number of instructions, got " + std::string(argv[i]));
+                return 1;
+            }
+            game.SetScriptProfiled(sampleInstructionCount);
+        }
+        if (argument == "--texture-budget" && i + 1 < argc) {
+            // Followed by the budget in megabytes
+            game.SetTextureBudget(static_cast<std::size_t>(std::atoi(argv[++i])) * 1024 * 1024);
+        }
+    }
+
     game.Initialize();
     game.Run();
     game.Destroy();
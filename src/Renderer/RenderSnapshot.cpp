@@ -0,0 +1,83 @@
+#include "RenderSnapshot.h"
+
+void RenderSnapshot::Clear() {
+    commands.clear();
+    texts.clear();
+}
+
+void RenderSnapshot::AddSprite(SDL_Texture* texture, const SDL_Rect& srcRect, const SDL_Rect& dstRect, double angle, SDL_RendererFlip flip) {
+    RenderCommand command = {};
+    command.type = RENDER_SPRITE;
+    command.texture = texture;
+    command.srcRect = srcRect;
+    command.dstRect = dstRect;
+    command.angle = angle;
+    command.flip = flip;
+    commands.push_back(command);
+}
+
+void RenderSnapshot::AddText(TTF_Font* font, const std::string& text, const SDL_Color& color, int x, int y) {
+    RenderCommand command = {};
+    command.type = RENDER_TEXT;
+    command.font = font;
+    command.textIndex = static_cast<int>(texts.size());
+    command.dstRect = {x, y, 0, 0};
+    command.color = color;
+    commands.push_back(command);
+    texts.push_back(text);
+}
+
+void RenderSnapshot::AddRect(const SDL_Rect& rect, const SDL_Color& color, bool isFilled) {
+    RenderCommand command = {};
+    command.type = isFilled ? RENDER_FILLED_RECT : RENDER_RECT;
+    command.dstRect = rect;
+    command.color = color;
+    commands.push_back(command);
+}
+
+const std::vector<RenderCommand>& RenderSnapshot::GetCommands() const {
+    return commands;
+}
+
+RenderStats RenderSnapshot::Submit(SDL_Renderer* renderer) const {
+    RenderStats stats;
+    SDL_Texture* boundTexture = nullptr;
+
+    for (const auto& command: commands) {
+        stats.drawCalls++;
+        switch (command.type) {
+            case RENDER_SPRITE:
+                if (command.texture != boundTexture) {
+                    boundTexture = command.texture;
+                    stats.textureSwitches++;
+                }
+                SDL_RenderCopyEx(renderer, command.texture, &command.srcRect, &command.dstRect, command.angle, NULL, command.flip);
+                break;
+            case RENDER_TEXT: {
+                SDL_Surface* surface = TTF_RenderText_Blended(command.font, texts[command.textIndex].c_str(), command.color);
+                SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+                SDL_FreeSurface(surface);
+
+                SDL_Rect dstRect = command.dstRect;
+                SDL_QueryTexture(texture, NULL, NULL, &dstRect.w, &dstRect.h);
+                SDL_RenderCopy(renderer, texture, NULL, &dstRect);
+
+                // Every text goes through its own short lived texture
+                SDL_DestroyTexture(texture);
+                boundTexture = nullptr;
+                stats.textureSwitches++;
+                break;
+            }
+            case RENDER_RECT:
+                SDL_SetRenderDrawColor(renderer, command.color.r, command.color.g, command.color.b, 255);
+                SDL_RenderDrawRect(renderer, &command.dstRect);
+                break;
+            case RENDER_FILLED_RECT:
+                SDL_SetRenderDrawColor(renderer, command.color.r, command.color.g, command.color.b, 255);
+                SDL_RenderFillRect(renderer, &command.dstRect);
+                break;
+        }
+    }
+
+    return stats;
+}
@@ -0,0 +1,91 @@
+#ifndef RENDERSNAPSHOT_H
+#define RENDERSNAPSHOT_H
+
+#include <SDL.h>
+#include <SDL_ttf.h>
+#include <string>
+#include <vector>
+
+/// Enumeration of the different type of render commands.
+enum RenderCommandType {
+    RENDER_SPRITE,      // 0
+    RENDER_TEXT,        // 1
+    RENDER_RECT,        // 2
+    RENDER_FILLED_RECT  // 3
+};
+
+/// Structure containing the counters gathered while submitting a render snapshot.
+struct RenderStats {
+    /// Integer value representing the number of draw calls issued to the renderer.
+    int drawCalls = 0;
+    /// Integer value representing the number of times the bound texture changed between two copies.
+    int textureSwitches = 0;
+};
+
+/// Structure containing the information of a single draw operation.
+struct RenderCommand {
+    /// RenderCommandType value representing the draw operation to perform.
+    RenderCommandType type;
+    /// SDL_Texture pointer to copy from, sprites only.
+    SDL_Texture* texture;
+    /// TTF_Font pointer to render the text with, texts only.
+    TTF_Font* font;
+    /// Integer value representing the index of the text in the snapshot text list, texts only.
+    int textIndex;
+    /// SDL_Rect object representing the source rectangle in the texture, sprites only.
+    SDL_Rect srcRect;
+    /// SDL_Rect object representing the destination rectangle on screen, only its position is used by texts.
+    SDL_Rect dstRect;
+    /// SDL_Color object representing the color of texts and rectangles.
+    SDL_Color color;
+    /// Double value representing the rotation angle of sprites, in degrees.
+    double angle;
+    /// SDL_RendererFlip value representing the flipping of sprites.
+    SDL_RendererFlip flip;
+};
+
+/// Class responsible for holding an immutable list of draw commands extracted from the game state of one frame.
+/// @details The render systems only record commands in a snapshot. The snapshot is then submitted to the renderer,
+/// either right away or from another thread, which lets the simulation of the next frame run meanwhile.
+/// @file RenderSnapshot.h
+/// @author Maxime Héliot
+/// @version 0.1.0 18/10/2026
+class RenderSnapshot {
+private:
+    /// Vector of the draw commands, in submission order.
+    std::vector<RenderCommand> commands;
+    /// Vector of the texts referenced by the text commands.
+    std::vector<std::string> texts;
+
+public:
+    /// SDL Rectangle object defining the camera canvas the snapshot was extracted with.
+    SDL_Rect camera;
+
+    /// @brief Clear the snapshot
+    /// @details This method is responsible for removing all the commands, keeping their memory for the next frame.
+    void Clear();
+
+    /// @brief Add sprite command
+    /// @details This method is responsible for recording the copy of a texture region on screen.
+    void AddSprite(SDL_Texture* texture, const SDL_Rect& srcRect, const SDL_Rect& dstRect, double angle, SDL_RendererFlip flip);
+
+    /// @brief Add text command
+    /// @details This method is responsible for recording the render of a text with its top-left corner at the given position.
+    void AddText(TTF_Font* font, const std::string& text, const SDL_Color& color, int x, int y);
+
+    /// @brief Add rectangle command
+    /// @details This method is responsible for recording the draw of a rectangle outline, or of a filled rectangle.
+    void AddRect(const SDL_Rect& rect, const SDL_Color& color, bool isFilled);
+
+    /// @brief Snapshot commands accessor
+    /// @return The list of the recorded commands.
+    const std::vector<RenderCommand>& GetCommands() const;
+
+    /// @brief Submit the snapshot
+    /// @details This method is responsible for executing all the recorded commands on the given renderer, in order.
+    /// Must be called from the thread owning the renderer.
+    /// @return The draw call and texture switch counters of the submission.
+    RenderStats Submit(SDL_Renderer* renderer) const;
+};
+
+#endif // RENDERSNAPSHOT_H //
@@ -0,0 +1,158 @@
+#include "LuaHeap.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+
+LuaHeap::~LuaHeap() {
+    for (unsigned char* page: pages) {
+        std::free(page);
+    }
+}
+
+std::size_t LuaHeap::GetSizeClass(std::size_t size) {
+    return size == 0 ? 0 : (size - 1) / 16;
+}
+
+void* LuaHeap::AllocateBlock(std::size_t size) {
+    stats.numAllocations++;
+    if (size > LUA_HEAP_MAX_SMALL_BLOCK_SIZE) {
+        return std::malloc(size);
+    }
+
+    stats.numSmallAllocations++;
+    const std::size_t sizeClass = GetSizeClass(size);
+    if (FreeBlock* block = freeLists[sizeClass]) {
+        freeLists[sizeClass] = block->next;
+        return block;
+    }
+
+    // Carve the block out of the current page, the end of a full page is left to the free lists of smaller classes
+    const std::size_t blockSize = (sizeClass + 1) * 16;
+    if (static_cast<std::size_t>(pageEnd - pageCursor) < blockSize) {
+        while (static_cast<std::size_t>(pageEnd - pageCursor) >= 16) {
+            const std::size_t leftoverClass = GetSizeClass(std::min<std::size_t>(pageEnd - pageCursor, LUA_HEAP_MAX_SMALL_BLOCK_SIZE));
+            const std::size_t leftoverSize = (leftoverClass + 1) * 16;
+            auto* leftover = reinterpret_cast<FreeBlock*>(pageCursor);
+            leftover->next = freeLists[leftoverClass];
+            freeLists[leftoverClass] = leftover;
+            pageCursor += leftoverSize;
+        }
+
+        auto* page = static_cast<unsigned char*>(std::malloc(LUA_HEAP_PAGE_SIZE));
+        if (!page) {
+            return nullptr;
+        }
+        pages.push_back(page);
+        pageCursor = page;
+        pageEnd = page + LUA_HEAP_PAGE_SIZE;
+        stats.bytesInPages += LUA_HEAP_PAGE_SIZE;
+    }
+
+    void* block = pageCursor;
+    pageCursor += blockSize;
+    return block;
+}
+
+void LuaHeap::ReleaseBlock(void* block, std::size_t size) {
+    stats.numFrees++;
+    if (size > LUA_HEAP_MAX_SMALL_BLOCK_SIZE) {
+        std::free(block);
+        return;
+    }
+
+    const std::size_t sizeClass = GetSizeClass(size);
+    auto* freeBlock = static_cast<FreeBlock*>(block);
+    freeBlock->next = freeLists[sizeClass];
+    freeLists[sizeClass] = freeBlock;
+}
+
+void* LuaHeap::Allocate(void* heap, void* block, std::size_t oldSize, std::size_t newSize) {
+    return static_cast<LuaHeap*>(heap)->Reallocate(block, oldSize, newSize);
+}
+
+void* LuaHeap::Reallocate(void* block, std::size_t oldSize, std::size_t newSize) {
+    // Without a block, the old size only tells the type of the object being created
+    if (!block) {
+        oldSize = 0;
+    }
+
+    if (newSize == 0) {
+        if (block) {
+            ReleaseBlock(block, oldSize);
+            stats.bytesInUse -= oldSize;
+        }
+        return nullptr;
+    }
+
+    void* newBlock = nullptr;
+    if (block && oldSize <= LUA_HEAP_MAX_SMALL_BLOCK_SIZE && newSize <= LUA_HEAP_MAX_SMALL_BLOCK_SIZE &&
+        GetSizeClass(oldSize) == GetSizeClass(newSize)) {
+        // Still fits in its block
+        newBlock = block;
+    } else if (block && oldSize > LUA_HEAP_MAX_SMALL_BLOCK_SIZE && newSize > LUA_HEAP_MAX_SMALL_BLOCK_SIZE) {
+        newBlock = std::realloc(block, newSize);
+        if (!newBlock) {
+            return nullptr;
+        }
+    } else {
+        newBlock = AllocateBlock(newSize);
+        if (!newBlock) {
+            return nullptr;
+        }
+        if (block) {
+            std::memcpy(newBlock, block, std::min(oldSize, newSize));
+            ReleaseBlock(block, oldSize);
+        }
+    }
+
+    stats.bytesInUse = stats.bytesInUse - oldSize + newSize;
+    return newBlock;
+}
+
+void LuaHeap::TakeOverGarbageCollector(lua_State* luaState) {
+    lua_gc(luaState, LUA_GCSTOP, 0);
+    ResetGcThreshold();
+}
+
+void LuaHeap::StepGarbageCollector(lua_State* luaState, double budget) {
+    if (!isGcCycleRunning && stats.bytesInUse < gcThreshold) {
+        stats.lastGcTime = 0.0;
+        return;
+    }
+    isGcCycleRunning = true;
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto deadline = start + std::chrono::duration<double>(std::max(budget, 0.0));
+    do {
+        // The step also runs with the collector stopped, returning 1 when it ended the cycle
+        if (lua_gc(luaState, LUA_GCSTEP, LUA_HEAP_GC_STEP_KB)) {
+            isGcCycleRunning = false;
+            stats.numGcCycles++;
+            ResetGcThreshold();
+            break;
+        }
+    } while (std::chrono::steady_clock::now() < deadline);
+
+    stats.lastGcTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    stats.maxGcTime = std::max(stats.maxGcTime, stats.lastGcTime);
+    stats.totalGcTime += stats.lastGcTime;
+}
+
+void LuaHeap::CollectGarbage(lua_State* luaState) {
+    const auto start = std::chrono::steady_clock::now();
+    lua_gc(luaState, LUA_GCCOLLECT, 0);
+    stats.totalGcTime += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    isGcCycleRunning = false;
+    stats.numGcCycles++;
+    ResetGcThreshold();
+}
+
+void LuaHeap::ResetGcThreshold() {
+    gcThreshold = std::max(LUA_HEAP_MIN_GC_THRESHOLD, stats.bytesInUse * 2);
+}
+
+const LuaHeapStats& LuaHeap::GetStats() const {
+    return stats;
+}
@@ -0,0 +1,131 @@
+#ifndef LUAHEAP_H
+#define LUAHEAP_H
+
+#include <sol/sol.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/// Size, in bytes, of the pages the small blocks are carved from.
+const std::size_t LUA_HEAP_PAGE_SIZE = 64 * 1024;
+
+/// Size, in bytes, of the largest block served by the size classes, the larger ones going to malloc.
+const std::size_t LUA_HEAP_MAX_SMALL_BLOCK_SIZE = 256;
+
+/// Amount of allocation debt, in kilobytes, paid by a single incremental garbage collector step.
+const int LUA_HEAP_GC_STEP_KB = 16;
+
+/// Memory in use, in bytes, below which no garbage collection cycle starts.
+const std::size_t LUA_HEAP_MIN_GC_THRESHOLD = 4 * 1024 * 1024;
+
+/// Structure holding the metrics of a Lua heap.
+struct LuaHeapStats {
+    /// Integer value representing the number of blocks allocated so far, resized blocks moving included.
+    std::uint64_t numAllocations = 0;
+    /// Integer value representing the number of blocks allocated so far from the size classes.
+    std::uint64_t numSmallAllocations = 0;
+    /// Integer value representing the number of blocks freed so far.
+    std::uint64_t numFrees = 0;
+    /// Integer value representing the bytes currently allocated by Lua.
+    std::size_t bytesInUse = 0;
+    /// Integer value representing the bytes of the pages carved into small blocks.
+    std::size_t bytesInPages = 0;
+    /// Integer value representing the number of garbage collection cycles completed so far.
+    std::uint64_t numGcCycles = 0;
+    /// Double value representing the time spent collecting garbage at the last step, in milliseconds.
+    double lastGcTime = 0.0;
+    /// Double value representing the longest time spent collecting garbage at a single step, in milliseconds.
+    double maxGcTime = 0.0;
+    /// Double value representing the time spent collecting garbage so far, in milliseconds.
+    double totalGcTime = 0.0;
+};
+
+/// Class responsible for the memory of a Lua state: its allocations and the pace of its garbage collector.
+/// @details The small blocks, most of the tables, strings and closures of the scripts, are served from free lists
+/// per size class, carved out of large pages that are never given back until the heap is destroyed. The automatic
+/// garbage collector is stopped: the game drives it in small steps, within a time budget it spends when idle.
+/// Not thread safe, only the thread owning the Lua state may use the heap.
+/// @file LuaHeap.h
+/// @author Maxime Héliot
+/// @version 0.1.0 18/10/2026
+class LuaHeap {
+private:
+    /// Structure overlaid on the free blocks to chain them.
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    /// Number of size classes, every 16 bytes up to LUA_HEAP_MAX_SMALL_BLOCK_SIZE.
+    static const std::size_t NUM_SIZE_CLASSES = LUA_HEAP_MAX_SMALL_BLOCK_SIZE / 16;
+
+    /// Array of the free lists of the size classes.
+    std::array<FreeBlock*, NUM_SIZE_CLASSES> freeLists{};
+    /// Vector of the pages, freed with the heap.
+    std::vector<unsigned char*> pages;
+    /// Pointer to the first byte of the current page not carved into a block yet.
+    unsigned char* pageCursor = nullptr;
+    /// Pointer past the last byte of the current page.
+    unsigned char* pageEnd = nullptr;
+    /// Boolean value representing a garbage collection cycle in progress.
+    bool isGcCycleRunning = false;
+    /// Integer value representing the memory in use, in bytes, above which the next cycle starts.
+    std::size_t gcThreshold = LUA_HEAP_MIN_GC_THRESHOLD;
+    /// LuaHeapStats object holding the metrics of the heap.
+    LuaHeapStats stats;
+
+    /// @brief Size class getter
+    /// @return The index of the size class of the given size, the size being at most LUA_HEAP_MAX_SMALL_BLOCK_SIZE.
+    static std::size_t GetSizeClass(std::size_t size);
+
+    /// @brief Allocate a block of the given size
+    void* AllocateBlock(std::size_t size);
+
+    /// @brief Give a block of the given size back
+    void ReleaseBlock(void* block, std::size_t size);
+
+    /// @brief Set the memory threshold of the next cycle, twice the memory in use once a cycle ended
+    void ResetGcThreshold();
+
+public:
+    /// @brief Default LuaHeap constructor
+    /// @details Base constructor of the LuaHeap class, holding no page until the first small allocation.
+    LuaHeap() = default;
+
+    /// @brief Default LuaHeap destructor
+    /// @details Base destructor of the LuaHeap class, freeing the pages. The Lua state must be closed before.
+    ~LuaHeap();
+
+    LuaHeap(const LuaHeap&) = delete;
+    LuaHeap& operator=(const LuaHeap&) = delete;
+
+    /// @brief Lua allocation function
+    /// @details The lua_Alloc function to create the Lua state with, with the heap as user data.
+    static void* Allocate(void* heap, void* block, std::size_t oldSize, std::size_t newSize);
+
+    /// @brief Reallocate a block
+    /// @details This method is responsible for allocating, resizing and freeing the blocks of Lua, as lua_Alloc does.
+    /// @param block: The block to resize, nullptr to allocate a new one.
+    /// @param oldSize: Integer value representing the size of the block, meaningless for a new one.
+    /// @param newSize: Integer value representing the size wanted, 0 to free the block.
+    /// @return The resized block, nullptr once freed or if out of memory.
+    void* Reallocate(void* block, std::size_t oldSize, std::size_t newSize);
+
+    /// @brief Stop the automatic garbage collector of a Lua state created with the heap
+    void TakeOverGarbageCollector(lua_State* luaState);
+
+    /// @brief Step the garbage collector
+    /// @details This method is responsible for running incremental garbage collection steps until the budget is spent
+    /// or the cycle ends. A cycle only starts once the memory in use reached the threshold, and at least one step is
+    /// run while a cycle is in progress, so that the memory can not grow unbounded through busy frames.
+    /// @param budget: Double value representing the time the steps may take, in seconds.
+    void StepGarbageCollector(lua_State* luaState, double budget);
+
+    /// @brief Run a full garbage collection cycle, for the loading times
+    void CollectGarbage(lua_State* luaState);
+
+    /// @brief Metrics getter
+    const LuaHeapStats& GetStats() const;
+};
+
+#endif // LUAHEAP_H //
@@ -0,0 +1,120 @@
+#include "PureScriptRunner.h"
+#include "../Logger/Logger.h"
+#include "../Components/ScriptComponent.h"
+#include "../Game/LevelCompiler.h"
+#include <algorithm>
+#include <utility>
+
+PureScriptRunner::PureScriptRunner(BindingsFactory createBindings, unsigned int numStates):
+    createBindings(std::move(createBindings)), numStates(numStates) {}
+
+bool PureScriptRunner::SetLevel(int levelNumber, std::size_t numPureScripts) {
+    states.clear();
+    if (levelNumber < 0 || numPureScripts == 0) {
+        return true;
+    }
+
+    if (!jobSystem) {
+        jobSystem = std::make_unique<JobSystem>(numStates);
+    }
+
+    // No more states than the scripts can keep busy, each one loaded by its own worker
+    const std::size_t numWorkerStates = std::min<std::size_t>(std::max(jobSystem->GetNumWorkers(), 1u),
+                                                              (numPureScripts + PURE_SCRIPTS_PER_JOB - 1) / PURE_SCRIPTS_PER_JOB);
+    states.resize(numWorkerStates);
+    std::vector<char> isLoaded(states.size(), 0);
+    for (std::size_t i = 0; i < states.size(); i++) {
+        jobSystem->Submit([this, i, levelNumber, &isLoaded]() {
+            isLoaded[i] = CreateState(states[i], levelNumber);
+        });
+    }
+    jobSystem->Wait();
+
+    if (std::find(isLoaded.begin(), isLoaded.end(), 0) != isLoaded.end()) {
+        states.clear();
+        return false;
+    }
+    Logger::Log("Pure scripts running on " + std::to_string(states.size()) + " worker Lua states");
+    return true;
+}
+
+bool PureScriptRunner::CreateState(WorkerState& state, int levelNumber) const {
+    state.heap = std::make_unique<LuaHeap>();
+    state.lua = std::make_unique<sol::state>(sol::default_at_panic, &LuaHeap::Allocate, state.heap.get());
+    state.heap->TakeOverGarbageCollector(state.lua->lua_state());
+    state.lua->open_libraries(sol::lib::base, sol::lib::math, sol::lib::os);
+    createBindings(*state.lua, state.deferredKills);
+
+    LevelCompiler compiler;
+    if (!compiler.RunLevelScript(*state.lua, levelNumber)) {
+        return false;
+    }
+    state.heap->CollectGarbage(state.lua->lua_state());
+    return true;
+}
+
+void PureScriptRunner::RunRange(WorkerState& state, const std::vector<Entity>& entities, std::size_t begin, std::size_t end,
+                                double deltaTime, int ellapsedTime) {
+    for (std::size_t i = begin; i < end; i++) {
+        const Entity& entity = entities[i];
+        const int levelEntityIndex = entity.GetComponent<ScriptComponent>().levelEntityIndex;
+
+        // The function is fetched once per entity index, from the Level table of this state
+        auto found = state.functions.find(levelEntityIndex);
+        if (found == state.functions.end()) {
+            sol::optional<sol::protected_function> function =
+                    (*state.lua)["Level"]["entities"][levelEntityIndex]["components"]["on_update_script"][0];
+            found = state.functions.emplace(levelEntityIndex, function.value_or(sol::protected_function())).first;
+        }
+        if (!found->second.valid()) {
+            state.errors.push_back("No pure script found for the level entity " + std::to_string(levelEntityIndex));
+            continue;
+        }
+
+        sol::protected_function_result result = found->second(entity, deltaTime, ellapsedTime);
+        if (!result.valid()) {
+            sol::error error = result;
+            state.errors.push_back("Error running the pure script of the entity " + std::to_string(entity.GetId()) + ": " + error.what());
+        }
+    }
+    state.heap->StepGarbageCollector(state.lua->lua_state(), PURE_SCRIPTS_GC_BUDGET);
+}
+
+bool PureScriptRunner::Run(const std::vector<Entity>& entities, double deltaTime, int ellapsedTime) {
+    if (states.empty()) {
+        return false;
+    }
+    if (entities.empty()) {
+        return true;
+    }
+
+    // Few scripts are not worth waking the workers up
+    const std::size_t numJobs = std::min(states.size(), (entities.size() + PURE_SCRIPTS_PER_JOB - 1) / PURE_SCRIPTS_PER_JOB);
+    const std::size_t rangeSize = (entities.size() + numJobs - 1) / numJobs;
+    if (numJobs == 1) {
+        RunRange(states[0], entities, 0, entities.size(), deltaTime, ellapsedTime);
+    } else {
+        for (std::size_t job = 0; job < numJobs; job++) {
+            const std::size_t begin = job * rangeSize;
+            const std::size_t end = std::min(begin + rangeSize, entities.size());
+            WorkerState* state = &states[job];
+            jobSystem->Submit([state, &entities, begin, end, deltaTime, ellapsedTime]() {
+                RunRange(*state, entities, begin, end, deltaTime, ellapsedTime);
+            });
+        }
+        jobSystem->Wait();
+    }
+
+    // Apply what the scripts deferred, now that no job touches the registry anymore
+    for (auto& state: states) {
+        for (auto& entity: state.deferredKills) {
+            entity.Kill();
+        }
+        state.deferredKills.clear();
+        for (const auto& error: state.errors) {
+            Logger::Err(error);
+        }
+        state.errors.clear();
+    }
+    return true;
+}
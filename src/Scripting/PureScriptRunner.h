@@ -0,0 +1,104 @@
+#ifndef PURESCRIPTRUNNER_H
+#define PURESCRIPTRUNNER_H
+
+#include "../ECS/ECS.h"
+#include "../Concurrency/JobSystem.h"
+#include "LuaHeap.h"
+#include <sol/sol.hpp>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/// Minimum number of pure scripts handed to a worker Lua state, fewer ones running on the calling thread.
+const std::size_t PURE_SCRIPTS_PER_JOB = 32;
+
+/// Time, in seconds, a worker Lua state may spend collecting its garbage after running its scripts of a tick.
+const double PURE_SCRIPTS_GC_BUDGET = 0.0005;
+
+/// Class responsible for running the pure update scripts in parallel, on Lua states owned by worker jobs.
+/// @details A pure script only reads and writes the components of its own entity. Every worker Lua state runs the
+/// level script once, then fetches the update functions from its own Level table by entity index, so that no Lua
+/// value is ever shared between two states. The entities are split in one contiguous range per state, each range
+/// run by a single job. The kills asked by the scripts are deferred until every job is done, then applied by the
+/// calling thread, as are the errors logged. The globals a pure script writes stay in the state it ran on. Like the
+/// main state, every worker state allocates from its own LuaHeap, its garbage collector being stepped by the job
+/// right after the scripts of the tick.
+/// @file PureScriptRunner.h
+/// @author Maxime Héliot
+/// @version 0.1.0 18/10/2026
+class PureScriptRunner {
+public:
+    /// Function creating the Lua bindings of a worker state, the kills asked by its scripts going to the given vector.
+    using BindingsFactory = std::function<void(sol::state& lua, std::vector<Entity>& deferredKills)>;
+
+private:
+    /// Structure holding a worker Lua state and what its scripts produced.
+    struct WorkerState {
+        /// The heap of the Lua state, declared first so that it outlives the state.
+        std::unique_ptr<LuaHeap> heap;
+        /// The Lua state, running the level script.
+        std::unique_ptr<sol::state> lua;
+        /// Map of the update functions fetched from the Level table of the state, by entity index.
+        std::unordered_map<int, sol::protected_function> functions;
+        /// Vector of the entities the scripts asked to kill during the current run.
+        std::vector<Entity> deferredKills;
+        /// Vector of the errors raised by the scripts during the current run.
+        std::vector<std::string> errors;
+    };
+
+    /// Function creating the Lua bindings of the worker states.
+    BindingsFactory createBindings;
+    /// Integer value representing the number of worker states, zero to match the hardware threads.
+    unsigned int numStates;
+    /// JobSystem object running the worker states, started with the first level having pure scripts.
+    std::unique_ptr<JobSystem> jobSystem;
+    /// Vector of the worker states, created when the level is set.
+    std::vector<WorkerState> states;
+
+    /// @brief Create a worker state running the level script
+    /// @details Runs on a worker, the bytecode of the level script being dumped by the main state beforehand.
+    /// @return A boolean value representing the success status of the level script.
+    bool CreateState(WorkerState& state, int levelNumber) const;
+
+    /// @brief Run the scripts of a range of entities on a worker state
+    static void RunRange(WorkerState& state, const std::vector<Entity>& entities, std::size_t begin, std::size_t end,
+                         double deltaTime, int ellapsedTime);
+
+public:
+    /// @brief Default PureScriptRunner constructor
+    /// @details Base constructor of the PureScriptRunner class, the workers and their states being created when a
+    /// level with pure scripts is set.
+    /// @param createBindings: Function creating the Lua bindings of a worker state.
+    /// @param numStates: The number of worker states, zero to keep one hardware thread free for the calling thread.
+    explicit PureScriptRunner(BindingsFactory createBindings, unsigned int numStates = 0);
+
+    PureScriptRunner(const PureScriptRunner&) = delete;
+    PureScriptRunner& operator=(const PureScriptRunner&) = delete;
+
+    /// @brief Level setter
+    /// @details This method is responsible for dropping the worker states of the previous level and creating the
+    /// ones of the given level, one per PURE_SCRIPTS_PER_JOB scripts up to the number of workers, each running the
+    /// level script in parallel on its own worker. No state nor worker is created for a level without pure scripts.
+    /// To be called again when the level is reloaded.
+    /// @param levelNumber: Integer value representing the index of the level the scripts come from.
+    /// @param numPureScripts: Integer value representing the number of pure scripts of the level.
+    /// @return A boolean value representing the success status of the level script in every worker state, false for
+    /// the pure scripts to run on the calling thread.
+    bool SetLevel(int levelNumber, std::size_t numPureScripts);
+
+    /// @brief Run the pure scripts
+    /// @details This method is responsible for calling the update function of every given entity on the worker
+    /// states, blocking until they are all done, then applying the deferred kills. The entities need a pure script
+    /// component with its entity index.
+    /// @param entities: Vector of the entities to run the scripts of, untouched by the scripts.
+    /// @param deltaTime: Double value representing the time elapsed since the previous update, in seconds.
+    /// @param ellapsedTime: Integer value representing the time elapsed since the start of the game, in milliseconds.
+    /// @return A boolean value representing the availability of the worker states, false to run the scripts on the
+    /// calling thread instead.
+    bool Run(const std::vector<Entity>& entities, double deltaTime, int ellapsedTime);
+};
+
+#endif // PURESCRIPTRUNNER_H //
@@ -0,0 +1,202 @@
+#include "ScriptProfiler.h"
+#include "../Logger/Logger.h"
+#include <algorithm>
+#include <fstream>
+
+ScriptProfiler* ScriptProfiler::hookedProfiler = nullptr;
+
+/// @brief Escape a string to be written in a JSON document
+static std::string EscapeJson(const std::string& value) {
+    std::string escaped;
+    escaped.reserve(value.size());
+    for (const char character: value) {
+        switch (character) {
+            case '"': escaped += "\\\""; break;
+            case '\\': escaped += "\\\\"; break;
+            case '\n': escaped += "\\n"; break;
+            case '\t': escaped += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(character) < 0x20) {
+                    escaped += ' ';
+                } else {
+                    escaped += character;
+                }
+        }
+    }
+    return escaped;
+}
+
+/// @brief Sort the entries of a map, from the greatest to the lowest value
+template <typename TKey, typename TValue, typename TCompare>
+static std::vector<std::pair<TKey, TValue>> SortEntries(const std::unordered_map<TKey, TValue>& map, TCompare isGreater) {
+    std::vector<std::pair<TKey, TValue>> entries(map.begin(), map.end());
+    std::sort(entries.begin(), entries.end(), [&isGreater](const auto& a, const auto& b) {
+        return isGreater(a.second, b.second);
+    });
+    return entries;
+}
+
+ScriptProfiler::~ScriptProfiler() {
+    Disable();
+}
+
+void ScriptProfiler::Enable(lua_State* state, int instructionCount) {
+    Disable();
+    luaState = state;
+    sampleCount = std::max(instructionCount, 1);
+    hookedProfiler = this;
+    lua_sethook(luaState, &ScriptProfiler::SampleHook, LUA_MASKCOUNT, sampleCount);
+    Logger::Log("Script profiler enabled, sampling every " + std::to_string(sampleCount) + " instructions");
+}
+
+void ScriptProfiler::Disable() {
+    if (!luaState) {
+        return;
+    }
+    // The coroutines started meanwhile keep the hook, which ignores them from now on
+    lua_sethook(luaState, nullptr, 0, 0);
+    if (hookedProfiler == this) {
+        hookedProfiler = nullptr;
+    }
+    luaState = nullptr;
+}
+
+void ScriptProfiler::SampleHook(lua_State* state, lua_Debug*) {
+    ScriptProfiler* profiler = hookedProfiler;
+    if (!profiler) {
+        return;
+    }
+
+    // Walk from the innermost frame, then fold the stack outermost first
+    std::vector<std::string> frames;
+    lua_Debug frame;
+    for (int level = 0; lua_getstack(state, level, &frame); level++) {
+        if (!lua_getinfo(state, "Sl", &frame)) {
+            break;
+        }
+        if (frame.currentline >= 0) {
+            frames.push_back(std::string(frame.short_src) + ":" + std::to_string(frame.currentline));
+        } else {
+            frames.emplace_back(frame.what && std::string(frame.what) == "C" ? "[C]" : frame.short_src);
+        }
+    }
+
+    std::string stack;
+    for (auto it = frames.rbegin(); it != frames.rend(); ++it) {
+        if (!stack.empty()) {
+            stack += ';';
+        }
+        stack += *it;
+    }
+    profiler->stackSamples[stack]++;
+    profiler->numSamples++;
+}
+
+const std::string& ScriptProfiler::GetFunctionLocation(const sol::reference& function) {
+    const void* address = function.pointer();
+    auto found = functionLocations.find(address);
+    if (found != functionLocations.end()) {
+        return found->second;
+    }
+
+    std::string location = "?";
+    lua_State* state = function.lua_state();
+    function.push();
+    lua_Debug debug;
+    // Pops the function
+    if (lua_getinfo(state, ">S", &debug)) {
+        location = std::string(debug.short_src) + ":" + std::to_string(debug.linedefined);
+    }
+    return functionLocations.emplace(address, location).first->second;
+}
+
+void ScriptProfiler::EndCall(const sol::reference& function, int entityId, std::chrono::steady_clock::time_point start) {
+    if (!IsEnabled()) {
+        return;
+    }
+    const double time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    auto addCall = [time](ScriptTiming& timing) {
+        timing.numCalls++;
+        timing.totalTime += time;
+        timing.maxTime = std::max(timing.maxTime, time);
+    };
+    addCall(functionTimings[GetFunctionLocation(function)]);
+    if (entityId >= 0) {
+        addCall(entityTimings[entityId]);
+    }
+}
+
+void ScriptProfiler::Reset() {
+    functionLocations.clear();
+    functionTimings.clear();
+    entityTimings.clear();
+    stackSamples.clear();
+    numSamples = 0;
+}
+
+std::vector<std::pair<std::string, ScriptTiming>> ScriptProfiler::GetFunctionTimings() const {
+    return SortEntries(functionTimings, [](const ScriptTiming& a, const ScriptTiming& b) {
+        return a.totalTime > b.totalTime;
+    });
+}
+
+std::vector<std::pair<int, ScriptTiming>> ScriptProfiler::GetEntityTimings() const {
+    return SortEntries(entityTimings, [](const ScriptTiming& a, const ScriptTiming& b) {
+        return a.totalTime > b.totalTime;
+    });
+}
+
+std::vector<std::pair<std::string, std::uint64_t>> ScriptProfiler::GetStackSamples() const {
+    return SortEntries(stackSamples, [](std::uint64_t a, std::uint64_t b) {
+        return a > b;
+    });
+}
+
+bool ScriptProfiler::ExportJson(const std::string& filePath) const {
+    std::ofstream file(filePath);
+    if (!file) {
+        Logger::Err("Error opening the script profile file " + filePath);
+        return false;
+    }
+
+    auto writeTiming = [&file](const ScriptTiming& timing) {
+        file << "\"calls\": " << timing.numCalls << ", \"total_ms\": " << timing.totalTime
+             << ", \"max_ms\": " << timing.maxTime;
+    };
+
+    file << "{\n  \"sample_instruction_count\": " << sampleCount << ",\n  \"num_samples\": " << numSamples << ",\n";
+
+    file << "  \"functions\": [";
+    const auto functions = GetFunctionTimings();
+    for (std::size_t i = 0; i < functions.size(); i++) {
+        file << (i == 0 ? "\n" : ",\n") << "    {\"location\": \"" << EscapeJson(functions[i].first) << "\", ";
+        writeTiming(functions[i].second);
+        file << "}";
+    }
+    file << "\n  ],\n";
+
+    file << "  \"entities\": [";
+    const auto entities = GetEntityTimings();
+    for (std::size_t i = 0; i < entities.size(); i++) {
+        file << (i == 0 ? "\n" : ",\n") << "    {\"entity\": " << entities[i].first << ", ";
+        writeTiming(entities[i].second);
+        file << "}";
+    }
+    file << "\n  ],\n";
+
+    file << "  \"stacks\": [";
+    const auto stacks = GetStackSamples();
+    for (std::size_t i = 0; i < stacks.size(); i++) {
+        file << (i == 0 ? "\n" : ",\n") << "    {\"stack\": \"" << EscapeJson(stacks[i].first) << "\", \"samples\": "
+             << stacks[i].second << "}";
+    }
+    file << "\n  ]\n}\n";
+
+    if (!file) {
+        Logger::Err("Error writing the script profile file " + filePath);
+        return false;
+    }
+    Logger::Log("Script profile exported to " + filePath);
+    return true;
+}
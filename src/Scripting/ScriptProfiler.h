@@ -0,0 +1,136 @@
+#ifndef SCRIPTPROFILER_H
+#define SCRIPTPROFILER_H
+
+#include <sol/sol.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/// Default number of Lua instructions between two call stack samples.
+const int DEFAULT_SCRIPT_PROFILER_SAMPLE_COUNT = 1000;
+
+/// Path of the file the script profiles are exported to.
+const char* const SCRIPT_PROFILE_FILE_PATH = "./script_profile.json";
+
+/// Structure holding the timings of the script calls of a function or an entity.
+struct ScriptTiming {
+    /// Integer value representing the number of calls.
+    std::uint64_t numCalls = 0;
+    /// Double value representing the time spent in the calls, in milliseconds.
+    double totalTime = 0.0;
+    /// Double value representing the time spent in the longest call, in milliseconds.
+    double maxTime = 0.0;
+};
+
+/// Class responsible for measuring where the Lua scripts spend their time.
+/// @details Every script call made by the script system is timed and aggregated by the source location of its
+/// function and by entity, a batched call only counting for its function. On top of that, a count hook samples the
+/// Lua call stack every given number of instructions, folded as "outermost;...;innermost" frames. The coroutines
+/// started before the profiler are not sampled. Only the thread owning the Lua state may use the profiler.
+/// @file ScriptProfiler.h
+/// @author Maxime Héliot
+/// @version 0.1.0 18/10/2026
+class ScriptProfiler {
+private:
+    /// Profiler the hook of the Lua state reports to, nullptr when none is enabled.
+    static ScriptProfiler* hookedProfiler;
+
+    /// Lua state being profiled, nullptr when disabled.
+    lua_State* luaState = nullptr;
+    /// Integer value representing the number of Lua instructions between two samples.
+    int sampleCount = DEFAULT_SCRIPT_PROFILER_SAMPLE_COUNT;
+    /// Map of the source locations of the functions met so far, by the address of the function.
+    std::unordered_map<const void*, std::string> functionLocations;
+    /// Map of the timings by function source location.
+    std::unordered_map<std::string, ScriptTiming> functionTimings;
+    /// Map of the timings by entity id.
+    std::unordered_map<int, ScriptTiming> entityTimings;
+    /// Map of the number of samples by folded call stack.
+    std::unordered_map<std::string, std::uint64_t> stackSamples;
+    /// Integer value representing the number of samples taken.
+    std::uint64_t numSamples = 0;
+
+    /// @brief Count hook of the Lua state, sampling the call stack
+    static void SampleHook(lua_State* state, lua_Debug* debug);
+
+    /// @brief Function source location getter
+    /// @return The "source:line" location the function is defined at.
+    const std::string& GetFunctionLocation(const sol::reference& function);
+
+public:
+    /// @brief Default ScriptProfiler constructor
+    /// @details Base constructor of the ScriptProfiler class, disabled.
+    ScriptProfiler() = default;
+
+    /// @brief Default ScriptProfiler destructor
+    /// @details Base destructor of the ScriptProfiler class, removing its hook.
+    ~ScriptProfiler();
+
+    ScriptProfiler(const ScriptProfiler&) = delete;
+    ScriptProfiler& operator=(const ScriptProfiler&) = delete;
+
+    /// @brief Start profiling
+    /// @details This method is responsible for installing the sampling hook on the Lua state, the measures taken
+    /// before being kept.
+    /// @param state: The Lua state to profile.
+    /// @param instructionCount: Integer value representing the number of Lua instructions between two samples.
+    void Enable(lua_State* state, int instructionCount = DEFAULT_SCRIPT_PROFILER_SAMPLE_COUNT);
+
+    /// @brief Stop profiling, keeping the measures
+    void Disable();
+
+    /// @brief Enabled status getter
+    bool IsEnabled() const {
+        return luaState != nullptr;
+    }
+
+    /// @brief Start timing a script call
+    /// @return The time the call starts at, only meaningful when enabled.
+    std::chrono::steady_clock::time_point BeginCall() const {
+        return IsEnabled() ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+    }
+
+    /// @brief Stop timing a script call
+    /// @param function: The function called.
+    /// @param entityId: Integer value representing the id of the entity the call was made for, -1 for a batch.
+    /// @param start: The time the call started at, as returned by BeginCall.
+    void EndCall(const sol::reference& function, int entityId, std::chrono::steady_clock::time_point start);
+
+    /// @brief Forget the measures taken so far
+    void Reset();
+
+    /// @brief Function timings getter
+    /// @return The timings by function source location, from the most to the least expensive.
+    std::vector<std::pair<std::string, ScriptTiming>> GetFunctionTimings() const;
+
+    /// @brief Entity timings getter
+    /// @return The timings by entity id, from the most to the least expensive.
+    std::vector<std::pair<int, ScriptTiming>> GetEntityTimings() const;
+
+    /// @brief Call stack samples getter
+    /// @return The number of samples by folded call stack, from the most to the least sampled.
+    std::vector<std::pair<std::string, std::uint64_t>> GetStackSamples() const;
+
+    /// @brief Number of samples getter
+    std::uint64_t GetNumSamples() const {
+        return numSamples;
+    }
+
+    /// @brief Sample instruction count getter
+    int GetSampleCount() const {
+        return sampleCount;
+    }
+
+    /// @brief Export the measures
+    /// @details This method is responsible for writing the function and entity timings and the call stack samples
+    /// to a JSON file.
+    /// @param filePath: The path of the file to write.
+    /// @return A boolean value representing the success status of the export.
+    bool ExportJson(const std::string& filePath) const;
+};
+
+#endif // SCRIPTPROFILER_H //
@@ -0,0 +1,216 @@
+#include "ScriptQueries.h"
+#include "../Logger/Logger.h"
+#include "../Components/TransformComponent.h"
+#include "../Components/RigidBodyComponent.h"
+#include "../Components/SpriteComponent.h"
+#include "../Components/AnimationComponent.h"
+#include "../Components/BoxColliderComponent.h"
+#include "../Components/HealthComponent.h"
+#include "../Components/ProjectileEmitterComponent.h"
+#include "../Components/ProjectileComponent.h"
+#include "../Components/ScriptComponent.h"
+#include "../Components/KeyboardControlledComponent.h"
+#include "../Components/CameraFollowComponent.h"
+#include <limits>
+
+/// @brief Mark the bounds of an entity as changed after a script wrote its position.
+static void MarkWritten(TransformComponent& transform) {
+    transform.isDirty = true;
+}
+
+/// @brief Writing the velocity of an entity leaves its bounds unchanged.
+static void MarkWritten(RigidBodyComponent&) {
+}
+
+/// @brief Read the entity id at the top of the Lua stack, failing for anything else than an integer in the id range.
+static bool ReadEntityId(lua_State* luaState, int& entityId) {
+    int isNumber = 0;
+    const lua_Integer value = lua_tointegerx(luaState, -1, &isNumber);
+    if (!isNumber || value < 0 || value > std::numeric_limits<int>::max()) {
+        return false;
+    }
+    entityId = static_cast<int>(value);
+    return true;
+}
+
+void ScriptQueries::CreateLuaBindings(sol::state& lua, Registry& queriedRegistry) {
+    registry = &queriedRegistry;
+    componentIds = {
+        {"transform", Component<TransformComponent>::GetId()},
+        {"rigidbody", Component<RigidBodyComponent>::GetId()},
+        {"sprite", Component<SpriteComponent>::GetId()},
+        {"animation", Component<AnimationComponent>::GetId()},
+        {"boxcollider", Component<BoxColliderComponent>::GetId()},
+        {"health", Component<HealthComponent>::GetId()},
+        {"projectile_emitter", Component<ProjectileEmitterComponent>::GetId()},
+        {"projectile", Component<ProjectileComponent>::GetId()},
+        {"script", Component<ScriptComponent>::GetId()},
+        {"keyboard_controller", Component<KeyboardControlledComponent>::GetId()},
+        {"camera_follow", Component<CameraFollowComponent>::GetId()}
+    };
+
+    lua.set_function("get_group_entities", &ScriptQueries::GetGroupEntities, this);
+    lua.set_function("get_entities_with", &ScriptQueries::GetEntitiesWith, this);
+    lua.set_function("get_positions", &ScriptQueries::GetPositions, this);
+    lua.set_function("get_velocities", &ScriptQueries::GetVelocities, this);
+    lua.set_function("set_positions", &ScriptQueries::SetPositions, this);
+    lua.set_function("set_velocities", &ScriptQueries::SetVelocities, this);
+    lua.set_function("set_rotations", &ScriptQueries::SetRotations, this);
+}
+
+bool ScriptQueries::ReadSignature(const sol::variadic_args& names, Signature& signature) const {
+    signature.reset();
+    for (const auto& name: names) {
+        const std::string componentName = name.as<std::string>();
+        auto found = componentIds.find(componentName);
+        if (found == componentIds.end()) {
+            Logger::Err("Trying to query the entities by an unknown component: " + componentName);
+            return false;
+        }
+        signature.set(found->second);
+    }
+    return true;
+}
+
+int ScriptQueries::WriteIds(const sol::table& ids) const {
+    lua_State* luaState = ids.lua_state();
+    ids.push();
+    for (std::size_t i = 0; i < entities.size(); i++) {
+        lua_pushinteger(luaState, entities[i].GetId());
+        lua_rawseti(luaState, -2, static_cast<lua_Integer>(i + 1));
+    }
+    lua_pop(luaState, 1);
+    return static_cast<int>(entities.size());
+}
+
+int ScriptQueries::GetGroupEntities(const std::string& group, const sol::table& ids, sol::variadic_args components) {
+    Signature signature;
+    if (!ReadSignature(components, signature)) {
+        return 0;
+    }
+    registry->GetEntitiesByGroup(group, signature, entities);
+    return WriteIds(ids);
+}
+
+int ScriptQueries::GetEntitiesWith(const sol::table& ids, sol::variadic_args components) {
+    Signature signature;
+    if (!ReadSignature(components, signature)) {
+        return 0;
+    }
+    if (signature.none()) {
+        Logger::Err("Trying to query the entities without any component");
+        return 0;
+    }
+    registry->GetEntitiesWithSignature(signature, entities);
+    return WriteIds(ids);
+}
+
+template <typename TComponent>
+void ScriptQueries::ReadVectors(const sol::table& ids, int count, const sol::table& xs, const sol::table& ys, glm::vec2 TComponent::* field) const {
+    lua_State* luaState = ids.lua_state();
+    ids.push();
+    xs.push();
+    ys.push();
+    const int idsIndex = lua_absindex(luaState, -3);
+    const int xsIndex = lua_absindex(luaState, -2);
+    const int ysIndex = lua_absindex(luaState, -1);
+
+    const int componentId = Component<TComponent>::GetId();
+    for (int i = 1; i <= count; i++) {
+        lua_rawgeti(luaState, idsIndex, i);
+        int entityId = -1;
+        const bool isId = ReadEntityId(luaState, entityId);
+        lua_pop(luaState, 1);
+
+        // The signature of a killed entity is cleared, only the live ones holding the component are read
+        glm::vec2 value(0.0f);
+        if (isId && registry->GetEntitySignature(entityId).test(componentId)) {
+            Entity entity(entityId);
+            entity.registry = registry;
+            value = entity.GetComponent<TComponent>().*field;
+        }
+        lua_pushnumber(luaState, value.x);
+        lua_rawseti(luaState, xsIndex, i);
+        lua_pushnumber(luaState, value.y);
+        lua_rawseti(luaState, ysIndex, i);
+    }
+    lua_pop(luaState, 3);
+}
+
+template <typename TComponent>
+void ScriptQueries::WriteVectors(const sol::table& ids, int count, const sol::table& xs, const sol::table& ys, glm::vec2 TComponent::* field) const {
+    lua_State* luaState = ids.lua_state();
+    ids.push();
+    xs.push();
+    ys.push();
+    const int idsIndex = lua_absindex(luaState, -3);
+    const int xsIndex = lua_absindex(luaState, -2);
+    const int ysIndex = lua_absindex(luaState, -1);
+
+    const int componentId = Component<TComponent>::GetId();
+    for (int i = 1; i <= count; i++) {
+        lua_rawgeti(luaState, idsIndex, i);
+        lua_rawgeti(luaState, xsIndex, i);
+        lua_rawgeti(luaState, ysIndex, i);
+        int isX = 0;
+        int isY = 0;
+        const glm::vec2 value(lua_tonumberx(luaState, -2, &isX), lua_tonumberx(luaState, -1, &isY));
+        lua_pop(luaState, 2);
+        int entityId = -1;
+        const bool isId = ReadEntityId(luaState, entityId);
+        lua_pop(luaState, 1);
+
+        // The slots not holding numbers are skipped, as are the killed entities and the ones without the component
+        if (isId && isX && isY && registry->GetEntitySignature(entityId).test(componentId)) {
+            Entity entity(entityId);
+            entity.registry = registry;
+            auto& component = entity.GetComponent<TComponent>();
+            component.*field = value;
+            MarkWritten(component);
+        }
+    }
+    lua_pop(luaState, 3);
+}
+
+void ScriptQueries::GetPositions(const sol::table& ids, int count, const sol::table& xs, const sol::table& ys) const {
+    ReadVectors(ids, count, xs, ys, &TransformComponent::position);
+}
+
+void ScriptQueries::GetVelocities(const sol::table& ids, int count, const sol::table& xs, const sol::table& ys) const {
+    ReadVectors(ids, count, xs, ys, &RigidBodyComponent::velocity);
+}
+
+void ScriptQueries::SetPositions(const sol::table& ids, int count, const sol::table& xs, const sol::table& ys) const {
+    WriteVectors(ids, count, xs, ys, &TransformComponent::position);
+}
+
+void ScriptQueries::SetVelocities(const sol::table& ids, int count, const sol::table& xs, const sol::table& ys) const {
+    WriteVectors(ids, count, xs, ys, &RigidBodyComponent::velocity);
+}
+
+void ScriptQueries::SetRotations(const sol::table& ids, int count, const sol::table& angles) const {
+    lua_State* luaState = ids.lua_state();
+    ids.push();
+    angles.push();
+    const int idsIndex = lua_absindex(luaState, -2);
+    const int anglesIndex = lua_absindex(luaState, -1);
+
+    const int componentId = Component<TransformComponent>::GetId();
+    for (int i = 1; i <= count; i++) {
+        lua_rawgeti(luaState, anglesIndex, i);
+        int isAngle = 0;
+        const double angle = lua_tonumberx(luaState, -1, &isAngle);
+        lua_pop(luaState, 1);
+        lua_rawgeti(luaState, idsIndex, i);
+        int entityId = -1;
+        const bool isId = ReadEntityId(luaState, entityId);
+        lua_pop(luaState, 1);
+
+        if (isId && isAngle && registry->GetEntitySignature(entityId).test(componentId)) {
+            Entity entity(entityId);
+            entity.registry = registry;
+            entity.GetComponent<TransformComponent>().rotation.x = static_cast<float>(angle);
+        }
+    }
+    lua_pop(luaState, 2);
+}
@@ -0,0 +1,82 @@
+#ifndef SCRIPTQUERIES_H
+#define SCRIPTQUERIES_H
+
+#include "../ECS/ECS.h"
+#include <sol/sol.hpp>
+#include <glm/glm.hpp>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/// Class responsible for the bulk queries and setters of the Lua scripts, one call covering many entities.
+/// @details The entities are handed to Lua as packed arrays of ids, the positions and velocities as arrays of
+/// numbers, all of them filled in tables given by the script so that it can keep them between updates:
+///
+///     local count = get_group_entities("enemies", ids, "transform")
+///     get_positions(ids, count, xs, ys)
+///     set_velocities(ids, count, vxs, vys)
+///
+/// The arrays are filled from 1 to the count, the slots past it left as they were. The slots whose id is not a live
+/// entity, or whose values are not numbers, are skipped by the setters and read as 0. The component sets are given
+/// by the names of the level tables: "transform", "rigidbody", "sprite", "animation", "boxcollider", "health",
+/// "projectile_emitter", "projectile", "script", "keyboard_controller" and "camera_follow".
+/// @file ScriptQueries.h
+/// @author Maxime Héliot
+/// @version 0.1.0 18/10/2026
+class ScriptQueries {
+private:
+    /// Registry the entities are queried from.
+    Registry* registry = nullptr;
+    /// Map of the component ids, by Lua name.
+    std::unordered_map<std::string, int> componentIds;
+    /// Vector of the entities of the current query, kept between queries to reuse its storage.
+    std::vector<Entity> entities;
+
+    /// @brief Component set reader
+    /// @param names: The Lua names of the components.
+    /// @param signature: Signature object receiving the components.
+    /// @return A boolean value representing the validity of every name.
+    bool ReadSignature(const sol::variadic_args& names, Signature& signature) const;
+
+    /// @brief Write the ids of the entities of the current query in a Lua array
+    /// @return The number of ids written.
+    int WriteIds(const sol::table& ids) const;
+
+    /// @brief Read a vector field of a component of the entities in two Lua arrays, 0 for the ids without it
+    template <typename TComponent>
+    void ReadVectors(const sol::table& ids, int count, const sol::table& xs, const sol::table& ys, glm::vec2 TComponent::* field) const;
+
+    /// @brief Write a vector field of a component of the entities from two Lua arrays, skipping the invalid slots
+    template <typename TComponent>
+    void WriteVectors(const sol::table& ids, int count, const sol::table& xs, const sol::table& ys, glm::vec2 TComponent::* field) const;
+
+public:
+    /// @brief Create the Lua bindings of the queries
+    /// @param registry: The registry the entities are queried from, outliving the Lua state.
+    void CreateLuaBindings(sol::state& lua, Registry& registry);
+
+    /// @brief Lua get_group_entities(group, ids, components...): ids of the entities of a group having the components
+    /// @return The number of entities.
+    int GetGroupEntities(const std::string& group, const sol::table& ids, sol::variadic_args components);
+
+    /// @brief Lua get_entities_with(ids, components...): ids of the entities having the components, at least one
+    /// @return The number of entities.
+    int GetEntitiesWith(const sol::table& ids, sol::variadic_args components);
+
+    /// @brief Lua get_positions(ids, count, xs, ys)
+    void GetPositions(const sol::table& ids, int count, const sol::table& xs, const sol::table& ys) const;
+
+    /// @brief Lua get_velocities(ids, count, xs, ys)
+    void GetVelocities(const sol::table& ids, int count, const sol::table& xs, const sol::table& ys) const;
+
+    /// @brief Lua set_positions(ids, count, xs, ys)
+    void SetPositions(const sol::table& ids, int count, const sol::table& xs, const sol::table& ys) const;
+
+    /// @brief Lua set_velocities(ids, count, xs, ys)
+    void SetVelocities(const sol::table& ids, int count, const sol::table& xs, const sol::table& ys) const;
+
+    /// @brief Lua set_rotations(ids, count, angles), the angles in degrees
+    void SetRotations(const sol::table& ids, int count, const sol::table& angles) const;
+};
+
+#endif // SCRIPTQUERIES_H //
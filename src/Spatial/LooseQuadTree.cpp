@@ -0,0 +1,141 @@
+#include "LooseQuadTree.h"
+#include <algorithm>
+#include <cmath>
+
+/// @brief Check the intersection between two bounding boxes.
+static bool Intersects(const BoundingBox& a, const BoundingBox& b) {
+    return (a.x < b.x + b.w &&
+            a.x + a.w > b.x &&
+            a.y < b.y + b.h &&
+            a.y + a.h > b.y
+    );
+}
+
+LooseQuadTree::LooseQuadTree(int maxDepth): maxDepth(maxDepth) {
+    levels.resize(maxDepth + 1);
+    for (int depth = 0; depth <= maxDepth; depth++) {
+        levels[depth].resize((1 << depth) * (1 << depth));
+    }
+}
+
+void LooseQuadTree::Reset(float width, float height) {
+    worldWidth = width;
+    worldHeight = height;
+    Clear();
+}
+
+void LooseQuadTree::Clear() {
+    for (auto& level: levels) {
+        for (auto& cell: level) {
+            cell.clear();
+        }
+    }
+    locations.clear();
+}
+
+float LooseQuadTree::GetWorldWidth() const {
+    return worldWidth;
+}
+
+float LooseQuadTree::GetWorldHeight() const {
+    return worldHeight;
+}
+
+int LooseQuadTree::FindCell(const BoundingBox& bounds, int& depth) const {
+    const float centerX = bounds.x + bounds.w / 2;
+    const float centerY = bounds.y + bounds.h / 2;
+
+    // Items centered outside the world, or bigger than it, live in the root cell which is always queried
+    depth = 0;
+    if (centerX < 0 || centerY < 0 || centerX >= worldWidth || centerY >= worldHeight) {
+        return 0;
+    }
+
+    // Go down the levels as long as the item still fits the nominal cell size
+    const float size = std::max(bounds.w, bounds.h);
+    while (depth < maxDepth && size <= std::min(worldWidth, worldHeight) / (1 << (depth + 1))) {
+        depth++;
+    }
+
+    const int cellsPerSide = 1 << depth;
+    const float cellWidth = worldWidth / cellsPerSide;
+    const float cellHeight = worldHeight / cellsPerSide;
+    const int cellX = std::min(static_cast<int>(centerX / cellWidth), cellsPerSide - 1);
+    const int cellY = std::min(static_cast<int>(centerY / cellHeight), cellsPerSide - 1);
+    return cellY * cellsPerSide + cellX;
+}
+
+void LooseQuadTree::Insert(int id, const BoundingBox& bounds) {
+    if (id >= static_cast<int>(locations.size())) {
+        locations.resize(id + 1);
+    }
+
+    // Unchanged bounds are the common case for an index kept between frames
+    Location& location = locations[id];
+    if (location.depth >= 0) {
+        const BoundingBox& indexedBounds = levels[location.depth][location.cell][location.slot].bounds;
+        if (indexedBounds.x == bounds.x && indexedBounds.y == bounds.y && indexedBounds.w == bounds.w && indexedBounds.h == bounds.h) {
+            return;
+        }
+    }
+
+    int depth = 0;
+    const int cell = FindCell(bounds, depth);
+    if (location.depth == depth && location.cell == cell) {
+        // Still in the same cell, only its bounds may have changed
+        levels[depth][cell][location.slot].bounds = bounds;
+        return;
+    }
+
+    Remove(id);
+    auto& items = levels[depth][cell];
+    items.push_back({id, bounds});
+    locations[id] = {depth, cell, static_cast<int>(items.size()) - 1};
+}
+
+void LooseQuadTree::Remove(int id) {
+    if (id < 0 || id >= static_cast<int>(locations.size()) || locations[id].depth < 0) {
+        return;
+    }
+
+    // Fill the slot of the item with the last one of its cell
+    Location& location = locations[id];
+    auto& items = levels[location.depth][location.cell];
+    items[location.slot] = items.back();
+    locations[items[location.slot].id].slot = location.slot;
+    items.pop_back();
+    location = Location();
+}
+
+void LooseQuadTree::Query(const BoundingBox& area, std::vector<int>& result) const {
+    for (int depth = 0; depth <= maxDepth; depth++) {
+        const int cellsPerSide = 1 << depth;
+        const float cellWidth = worldWidth / cellsPerSide;
+        const float cellHeight = worldHeight / cellsPerSide;
+
+        // Loose cells extend half a cell on each side, so widen the area by that much before picking cells
+        int minX = static_cast<int>(std::floor((area.x - cellWidth / 2) / cellWidth));
+        int minY = static_cast<int>(std::floor((area.y - cellHeight / 2) / cellHeight));
+        int maxX = static_cast<int>(std::floor((area.x + area.w + cellWidth / 2) / cellWidth));
+        int maxY = static_cast<int>(std::floor((area.y + area.h + cellHeight / 2) / cellHeight));
+        minX = std::max(minX, 0);
+        minY = std::max(minY, 0);
+        maxX = std::min(maxX, cellsPerSide - 1);
+        maxY = std::min(maxY, cellsPerSide - 1);
+
+        // The root cell also holds the items living outside the world bounds
+        if (depth == 0) {
+            minX = minY = maxX = maxY = 0;
+        }
+
+        for (int y = minY; y <= maxY; y++) {
+            for (int x = minX; x <= maxX; x++) {
+                for (const auto& item: levels[depth][y * cellsPerSide + x]) {
+                    if (Intersects(item.bounds, area)) {
+                        result.push_back(item.id);
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,108 @@
+#ifndef LOOSEQUADTREE_H
+#define LOOSEQUADTREE_H
+
+#include <vector>
+
+/// Structure representing an axis aligned bounding box in world coordinates.
+struct BoundingBox {
+    /// Float value representing the left position of the box.
+    float x;
+    /// Float value representing the top position of the box.
+    float y;
+    /// Float value representing the width of the box.
+    float w;
+    /// Float value representing the height of the box.
+    float h;
+};
+
+/// Class responsible for indexing bounding boxes by their world position to answer area queries.
+/// @details Every depth level of the tree is stored as a flat grid of cells. Cells are "loose": their query bounds are
+/// twice their nominal size, so an item only needs its center to be inside a cell to belong to it, and it is always
+/// stored at the deepest level where its largest side still fits the nominal cell size. The cell and slot of every
+/// item are kept by id, so that an item can be moved or removed without rebuilding the tree.
+/// @file LooseQuadTree.h
+/// @author Maxime Héliot
+/// @version 0.1.0 18/10/2026
+class LooseQuadTree {
+private:
+    /// Structure containing the data of an indexed item.
+    struct Item {
+        /// Integer value representing the id of the indexed item.
+        int id;
+        /// BoundingBox object representing the bounds of the indexed item.
+        BoundingBox bounds;
+    };
+
+    /// Structure locating an indexed item in the cell grids.
+    struct Location {
+        /// Integer value representing the depth level of the cell, -1 for an id not indexed.
+        int depth = -1;
+        /// Integer value representing the index of the cell in its level grid.
+        int cell = 0;
+        /// Integer value representing the index of the item in its cell.
+        int slot = 0;
+    };
+
+    /// Float value representing the width of the indexed world.
+    float worldWidth = 0;
+    /// Float value representing the height of the indexed world.
+    float worldHeight = 0;
+    /// Integer value representing the deepest level of the tree.
+    int maxDepth;
+    /// Vector of cell grids, one per depth level.
+    /// @details levels[depth][cellY * (1 << depth) + cellX]
+    std::vector<std::vector<std::vector<Item>>> levels;
+    /// Vector of the location of every item.
+    /// @details locations[index = item id]
+    std::vector<Location> locations;
+
+    /// @brief Find the cell an item belongs to
+    /// @param bounds: BoundingBox object representing the bounds of the item.
+    /// @param depth: Integer value receiving the depth level of the cell.
+    /// @return The index of the cell in its level grid.
+    int FindCell(const BoundingBox& bounds, int& depth) const;
+
+public:
+    /// @brief LooseQuadTree constructor
+    /// @details Base constructor of the LooseQuadTree class taking the deepest level of the tree as parameter.
+    /// @param maxDepth: Integer value representing the deepest level of the tree.
+    LooseQuadTree(int maxDepth = 6);
+
+    /// @brief Reset the indexed world
+    /// @details This method is responsible for setting the world bounds covered by the tree, clearing all its items.
+    /// @param width: Float value representing the width of the world to index.
+    /// @param height: Float value representing the height of the world to index.
+    void Reset(float width, float height);
+
+    /// @brief Clear the tree
+    /// @details This method is responsible for removing every item of the tree, keeping the cells memory for reuse.
+    void Clear();
+
+    /// @brief World width getter
+    /// @return Float value representing the width of the indexed world.
+    float GetWorldWidth() const;
+
+    /// @brief World height getter
+    /// @return Float value representing the height of the indexed world.
+    float GetWorldHeight() const;
+
+    /// @brief Insert an item in the tree
+    /// @details This method is responsible for storing an item in the deepest cell its bounds can fit in. An item
+    /// already indexed under the same id is moved to its new cell, or left in place when its bounds did not change.
+    /// @param id: Integer value representing the id of the item to insert, not negative.
+    /// @param bounds: BoundingBox object representing the bounds of the item to insert.
+    void Insert(int id, const BoundingBox& bounds);
+
+    /// @brief Remove an item from the tree
+    /// @details This method is responsible for removing the item of the given id, if indexed, in constant time.
+    /// @param id: Integer value representing the id of the item to remove.
+    void Remove(int id);
+
+    /// @brief Query the tree
+    /// @details This method is responsible for collecting the ids of every item intersecting the given area.
+    /// @param area: BoundingBox object representing the area to query.
+    /// @param result: Vector to which the ids of the intersecting items are appended.
+    void Query(const BoundingBox& area, std::vector<int>& result) const;
+};
+
+#endif // LOOSEQUADTREE_H //
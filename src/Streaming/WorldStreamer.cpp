@@ -0,0 +1,307 @@
+#include "WorldStreamer.h"
+#include "../Components/TransformComponent.h"
+#include "../Components/SpriteComponent.h"
+#include "../Components/RigidBodyComponent.h"
+#include "../Components/HealthComponent.h"
+#include "../Game/LevelLoader.h"
+#include <algorithm>
+#include <cmath>
+
+WorldStreamer::WorldStreamer(int chunkSize): chunkSize(std::max(chunkSize, 1)) {
+    jobSystem = std::make_unique<JobSystem>(1);
+}
+
+WorldStreamer::~WorldStreamer() {
+    // The chunks being prepared read the tilemap, let them finish before it goes away
+    jobSystem.reset();
+}
+
+void WorldStreamer::SetWorld(Tilemap worldTilemap, const LevelTilemapDescription& worldTilemapDescription,
+                             std::vector<LevelEntityDescription> worldEntities, std::vector<LevelEntityScripts> worldEntityScripts) {
+    jobSystem->Wait();
+    worldGeneration++;
+    {
+        std::lock_guard<std::mutex> lock(preparedTilesMutex);
+        preparedTiles.clear();
+    }
+
+    tilemap = std::move(worldTilemap);
+    tilemapDescription = worldTilemapDescription;
+    entities = std::move(worldEntities);
+    entityScripts = std::move(worldEntityScripts);
+    entityScripts.resize(entities.size());
+    isEntityDestroyed.assign(entities.size(), false);
+    activeChunks.clear();
+    pendingChunks.clear();
+
+    chunkWorldSize = static_cast<float>(chunkSize * tilemapDescription.tileSize * tilemapDescription.scale);
+    if (chunkWorldSize > 0.0f) {
+        numChunksX = std::max((tilemap.GetNumCols() + chunkSize - 1) / chunkSize, 1);
+        numChunksY = std::max((tilemap.GetNumRows() + chunkSize - 1) / chunkSize, 1);
+    } else {
+        chunkWorldSize = 1.0f;
+        numChunksX = 1;
+        numChunksY = 1;
+    }
+    chunks.assign(static_cast<std::size_t>(numChunksX) * numChunksY, Chunk());
+
+    for (int i = 0; i < static_cast<int>(entities.size()); i++) {
+        chunks[GetChunkIndex(entities[i].transform.position)].entityDescriptions.push_back(i);
+    }
+}
+
+WorldStreamer::ChunkRange WorldStreamer::GetChunkRange(float x, float y, float w, float h) const {
+    ChunkRange range;
+    range.minX = std::max(static_cast<int>(std::floor(x / chunkWorldSize)), 0);
+    range.minY = std::max(static_cast<int>(std::floor(y / chunkWorldSize)), 0);
+    range.maxX = std::min(static_cast<int>(std::floor((x + w) / chunkWorldSize)), numChunksX - 1);
+    range.maxY = std::min(static_cast<int>(std::floor((y + h) / chunkWorldSize)), numChunksY - 1);
+    return range;
+}
+
+bool WorldStreamer::IsInRange(int chunkIndex, const ChunkRange& range) const {
+    return range.Contains(chunkIndex % numChunksX, chunkIndex / numChunksX);
+}
+
+int WorldStreamer::GetChunkIndex(glm::vec2 position) const {
+    const int x = std::clamp(static_cast<int>(std::floor(position.x / chunkWorldSize)), 0, numChunksX - 1);
+    const int y = std::clamp(static_cast<int>(std::floor(position.y / chunkWorldSize)), 0, numChunksY - 1);
+    return y * numChunksX + x;
+}
+
+std::vector<WorldStreamer::TileSpawn> WorldStreamer::BuildTiles(int chunkIndex) const {
+    std::vector<TileSpawn> tiles;
+    const int tileSize = tilemapDescription.tileSize;
+    const double tileWorldSize = tilemapDescription.scale * tileSize;
+    const int tilesPerRow = std::max(tilemapDescription.tilesPerRow, 1);
+    const int firstX = chunkIndex % numChunksX * chunkSize;
+    const int firstY = chunkIndex / numChunksX * chunkSize;
+    const int lastX = std::min(firstX + chunkSize, tilemap.GetNumCols());
+    const int lastY = std::min(firstY + chunkSize, tilemap.GetNumRows());
+
+    tiles.reserve(static_cast<std::size_t>(std::max(lastX - firstX, 0)) * std::max(lastY - firstY, 0));
+    for (int y = firstY; y < lastY; y++) {
+        for (int x = firstX; x < lastX; x++) {
+            const int tileId = tilemap.GetTile(x, y);
+            tiles.push_back({
+                    glm::vec2(x * tileWorldSize, y * tileWorldSize),
+                    tileId % tilesPerRow * tileSize,
+                    tileId / tilesPerRow * tileSize
+            });
+        }
+    }
+    return tiles;
+}
+
+void WorldStreamer::ActivateChunk(Registry& registry, int chunkIndex) {
+    Chunk& chunk = chunks[chunkIndex];
+    if (chunk.state != CHUNK_PREPARED) {
+        chunk.tiles = BuildTiles(chunkIndex);
+    }
+
+    const float scale = static_cast<float>(tilemapDescription.scale);
+    const int tileSize = tilemapDescription.tileSize;
+    for (const auto& tile: chunk.tiles) {
+        Entity entity = registry.CreateEntity();
+        entity.AddComponent<TransformComponent>(tile.position, glm::vec2(scale, scale), glm::vec2(0.0, 0.0));
+        entity.AddComponent<SpriteComponent>(tilemapDescription.textureAssetId, tileSize, tileSize, 0, false, tile.srcRectX, tile.srcRectY);
+        entity.AddComponent<StreamedComponent>(chunkIndex);
+        chunk.residentEntities.push_back(entity);
+    }
+    // Rebuilt on the next activation, only the active part of the world keeps its tiles in memory
+    std::vector<TileSpawn>().swap(chunk.tiles);
+
+    for (auto descriptionIndex: chunk.entityDescriptions) {
+        if (isEntityDestroyed[descriptionIndex]) {
+            continue;
+        }
+        Entity entity = LevelLoader::CreateEntity(registry, entities[descriptionIndex], entityScripts[descriptionIndex]);
+        entity.AddComponent<StreamedComponent>(chunkIndex, descriptionIndex);
+        chunk.residentEntities.push_back(entity);
+    }
+
+    chunk.state = CHUNK_ACTIVE;
+    activeChunks.push_back(chunkIndex);
+}
+
+void WorldStreamer::MoveEntityDescription(int descriptionIndex, int fromChunkIndex, int toChunkIndex) {
+    if (fromChunkIndex == toChunkIndex) {
+        return;
+    }
+    auto& fromDescriptions = chunks[fromChunkIndex].entityDescriptions;
+    auto description = std::find(fromDescriptions.begin(), fromDescriptions.end(), descriptionIndex);
+    if (description != fromDescriptions.end()) {
+        *description = fromDescriptions.back();
+        fromDescriptions.pop_back();
+    }
+    chunks[toChunkIndex].entityDescriptions.push_back(descriptionIndex);
+}
+
+void WorldStreamer::WriteBackEntity(Entity entity, int descriptionIndex) {
+    LevelEntityDescription& description = entities[descriptionIndex];
+    if ((description.components & LEVEL_COMPONENT_TRANSFORM) && entity.HasComponent<TransformComponent>()) {
+        const auto& transform = entity.GetComponent<TransformComponent>();
+        description.transform.position = transform.position;
+        description.transform.rotation = transform.rotation;
+    }
+    if ((description.components & LEVEL_COMPONENT_RIGIDBODY) && entity.HasComponent<RigidBodyComponent>()) {
+        description.rigidbody.velocity = entity.GetComponent<RigidBodyComponent>().velocity;
+    }
+    if ((description.components & LEVEL_COMPONENT_HEALTH) && entity.HasComponent<HealthComponent>()) {
+        description.health.healthPercentage = entity.GetComponent<HealthComponent>().healthPercentage;
+    }
+}
+
+void WorldStreamer::DeactivateChunk(int chunkIndex) {
+    Chunk& chunk = chunks[chunkIndex];
+    for (auto& entity: chunk.residentEntities) {
+        auto& streamed = entity.GetComponent<StreamedComponent>();
+        if (streamed.descriptionIndex >= 0 && entity.HasComponent<TransformComponent>()) {
+            // The entity belongs to the chunk it stands in now, staying alive if that one is still active
+            const int currentChunkIndex = GetChunkIndex(entity.GetComponent<TransformComponent>().position);
+            MoveEntityDescription(streamed.descriptionIndex, streamed.chunkIndex, currentChunkIndex);
+            streamed.chunkIndex = currentChunkIndex;
+            if (currentChunkIndex != chunkIndex && chunks[currentChunkIndex].state == CHUNK_ACTIVE) {
+                chunks[currentChunkIndex].residentEntities.push_back(entity);
+                continue;
+            }
+            WriteBackEntity(entity, streamed.descriptionIndex);
+        }
+        streamed.isUnloading = true;
+        entity.Kill();
+    }
+    chunk.residentEntities.clear();
+    chunk.state = CHUNK_UNLOADED;
+}
+
+void WorldStreamer::Update(Registry& registry, const SDL_Rect& camera) {
+    if (chunks.empty()) {
+        return;
+    }
+
+    // Take the tiles the worker prepared meanwhile
+    std::vector<std::pair<std::pair<int, unsigned int>, std::vector<TileSpawn>>> readyTiles;
+    {
+        std::lock_guard<std::mutex> lock(preparedTilesMutex);
+        readyTiles.swap(preparedTiles);
+    }
+    for (auto& readyTile: readyTiles) {
+        const int chunkIndex = readyTile.first.first;
+        if (readyTile.first.second == worldGeneration && chunks[chunkIndex].state == CHUNK_PREPARING) {
+            chunks[chunkIndex].tiles = std::move(readyTile.second);
+            chunks[chunkIndex].state = CHUNK_PREPARED;
+        }
+    }
+
+    // Chunks are wanted a little before they show up and kept a little after they left, so that the camera moving
+    // back and forth over a chunk border does not activate and deactivate it on every tick
+    const float x = static_cast<float>(camera.x);
+    const float y = static_cast<float>(camera.y);
+    const float w = static_cast<float>(camera.w);
+    const float h = static_cast<float>(camera.h);
+    const float wantedMargin = chunkWorldSize / 2;
+    const float keptMargin = chunkWorldSize * 1.5f;
+    const ChunkRange viewRange = GetChunkRange(x, y, w, h);
+    const ChunkRange wantedRange = GetChunkRange(x - wantedMargin, y - wantedMargin, w + 2 * wantedMargin, h + 2 * wantedMargin);
+    const ChunkRange keptRange = GetChunkRange(x - keptMargin, y - keptMargin, w + 2 * keptMargin, h + 2 * keptMargin);
+
+    // The chunks next in the direction of travel are prepared ahead
+    const float travelX = static_cast<float>((camera.x > previousCamera.x) - (camera.x < previousCamera.x)) * chunkWorldSize;
+    const float travelY = static_cast<float>((camera.y > previousCamera.y) - (camera.y < previousCamera.y)) * chunkWorldSize;
+    const ChunkRange prefetchRange = GetChunkRange(x - wantedMargin + travelX, y - wantedMargin + travelY, w + 2 * wantedMargin, h + 2 * wantedMargin);
+    previousCamera = camera;
+
+    for (std::size_t i = 0; i < activeChunks.size();) {
+        if (!IsInRange(activeChunks[i], keptRange)) {
+            DeactivateChunk(activeChunks[i]);
+            activeChunks[i] = activeChunks.back();
+            activeChunks.pop_back();
+        } else {
+            i++;
+        }
+    }
+
+    // Closest first, the chunks in view are activated right away, the others a few per update
+    std::vector<int> wantedChunks;
+    for (int chunkY = wantedRange.minY; chunkY <= wantedRange.maxY; chunkY++) {
+        for (int chunkX = wantedRange.minX; chunkX <= wantedRange.maxX; chunkX++) {
+            const int chunkIndex = chunkY * numChunksX + chunkX;
+            if (chunks[chunkIndex].state != CHUNK_ACTIVE) {
+                wantedChunks.push_back(chunkIndex);
+            }
+        }
+    }
+    const glm::vec2 cameraCenter(x + w / 2, y + h / 2);
+    auto distanceToCamera = [this, &cameraCenter](int chunkIndex) {
+        const glm::vec2 chunkCenter((chunkIndex % numChunksX + 0.5f) * chunkWorldSize, (chunkIndex / numChunksX + 0.5f) * chunkWorldSize);
+        const glm::vec2 offset = chunkCenter - cameraCenter;
+        return offset.x * offset.x + offset.y * offset.y;
+    };
+    std::sort(wantedChunks.begin(), wantedChunks.end(), [&distanceToCamera](int a, int b) { return distanceToCamera(a) < distanceToCamera(b); });
+
+    int numActivations = 0;
+    for (auto chunkIndex: wantedChunks) {
+        if (!IsInRange(chunkIndex, viewRange)) {
+            if (numActivations >= MAX_CHUNK_ACTIVATIONS_PER_UPDATE) {
+                continue;
+            }
+            numActivations++;
+        }
+        ActivateChunk(registry, chunkIndex);
+    }
+
+    // Prepare the upcoming chunks on the worker, and drop the prepared ones the camera turned away from
+    for (int chunkY = prefetchRange.minY; chunkY <= prefetchRange.maxY; chunkY++) {
+        for (int chunkX = prefetchRange.minX; chunkX <= prefetchRange.maxX; chunkX++) {
+            const int chunkIndex = chunkY * numChunksX + chunkX;
+            if (chunks[chunkIndex].state != CHUNK_UNLOADED) {
+                continue;
+            }
+            chunks[chunkIndex].state = CHUNK_PREPARING;
+            pendingChunks.push_back(chunkIndex);
+            jobSystem->Submit([this, chunkIndex, generation = worldGeneration]() {
+                std::vector<TileSpawn> tiles = BuildTiles(chunkIndex);
+                std::lock_guard<std::mutex> lock(preparedTilesMutex);
+                preparedTiles.emplace_back(std::make_pair(chunkIndex, generation), std::move(tiles));
+            });
+        }
+    }
+    for (std::size_t i = 0; i < pendingChunks.size();) {
+        Chunk& chunk = chunks[pendingChunks[i]];
+        const bool isDropped = chunk.state == CHUNK_PREPARED && !IsInRange(pendingChunks[i], keptRange) && !IsInRange(pendingChunks[i], prefetchRange);
+        if (isDropped) {
+            std::vector<TileSpawn>().swap(chunk.tiles);
+            chunk.state = CHUNK_UNLOADED;
+        }
+        if (isDropped || chunk.state == CHUNK_ACTIVE || chunk.state == CHUNK_UNLOADED) {
+            pendingChunks[i] = pendingChunks.back();
+            pendingChunks.pop_back();
+        } else {
+            i++;
+        }
+    }
+}
+
+void WorldStreamer::OnEntityRemoved(Entity entity, const StreamedComponent& streamed) {
+    if (streamed.chunkIndex < 0 || streamed.chunkIndex >= static_cast<int>(chunks.size())) {
+        return;
+    }
+
+    auto& residentEntities = chunks[streamed.chunkIndex].residentEntities;
+    auto residentEntity = std::find_if(residentEntities.begin(), residentEntities.end(),
+                                       [&entity](const Entity& resident) { return resident.GetId() == entity.GetId(); });
+    if (residentEntity == residentEntities.end()) {
+        return;
+    }
+    *residentEntity = residentEntities.back();
+    residentEntities.pop_back();
+
+    // Destroyed in game, the entity does not come back when its chunk is activated again
+    if (!streamed.isUnloading && streamed.descriptionIndex >= 0 && streamed.descriptionIndex < static_cast<int>(entities.size())) {
+        isEntityDestroyed[streamed.descriptionIndex] = true;
+    }
+}
+
+std::size_t WorldStreamer::GetNumActiveChunks() const {
+    return activeChunks.size();
+}
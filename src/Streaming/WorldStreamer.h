@@ -0,0 +1,183 @@
+#ifndef WORLDSTREAMER_H
+#define WORLDSTREAMER_H
+
+#include "../ECS/ECS.h"
+#include "../AssetStore/Tilemap.h"
+#include "../Components/StreamedComponent.h"
+#include "../Concurrency/JobSystem.h"
+#include "../Game/LevelDescription.h"
+#include "../Game/LevelLoader.h"
+#include <SDL.h>
+#include <glm/glm.hpp>
+#include <sol/sol.hpp>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+/// Default side of a world chunk, in tiles.
+const int DEFAULT_CHUNK_SIZE = 16;
+
+/// Maximum number of chunks out of the camera view activated by a single update, the ones in view never wait.
+const int MAX_CHUNK_ACTIVATIONS_PER_UPDATE = 2;
+
+/// Class responsible for keeping in the registry only the part of the world around the camera.
+/// @details The tilemap and the level entities are partitioned into square chunks. A chunk is activated, its tiles
+/// and entities created, when it gets near the camera view, and deactivated, its entities killed, once the camera
+/// moved far enough from it. The tiles of the chunks ahead of the camera travel are prepared on a worker thread
+/// beforehand. An entity belongs to the chunk it starts in until its chunk is deactivated: it then moves to the chunk
+/// it stands in, staying alive if that chunk is active. Otherwise its position, rotation, velocity and health are
+/// written back to its description, the other components starting over from the level when it comes back with the
+/// chunk it stands in. The entities destroyed in game do not come back.
+/// @file WorldStreamer.h
+/// @author Maxime Héliot
+/// @version 0.1.0 18/10/2026
+class WorldStreamer {
+private:
+    /// Enumeration of the loading states of a chunk.
+    enum ChunkState {
+        CHUNK_UNLOADED,
+        CHUNK_PREPARING,
+        CHUNK_PREPARED,
+        CHUNK_ACTIVE
+    };
+
+    /// Structure holding what a tile entity is created with.
+    struct TileSpawn {
+        /// Vector2 object representing the world position of the tile.
+        glm::vec2 position;
+        /// Integer value representing the horizontal position of the tile in the tilemap texture.
+        int srcRectX;
+        /// Integer value representing the vertical position of the tile in the tilemap texture.
+        int srcRectY;
+    };
+
+    /// Structure holding an inclusive range of chunk coordinates.
+    struct ChunkRange {
+        int minX = 0;
+        int minY = 0;
+        int maxX = -1;
+        int maxY = -1;
+
+        /// @brief Check the chunk coordinates membership of the range
+        bool Contains(int x, int y) const {
+            return x >= minX && x <= maxX && y >= minY && y <= maxY;
+        }
+    };
+
+    /// Structure holding the state of a chunk of the world.
+    struct Chunk {
+        /// ChunkState value representing the loading state of the chunk.
+        ChunkState state = CHUNK_UNLOADED;
+        /// Vector of the indices of the entity descriptions starting in the chunk.
+        std::vector<int> entityDescriptions;
+        /// Vector of the tiles of the chunk, filled once prepared.
+        std::vector<TileSpawn> tiles;
+        /// Vector of the entities of the chunk living in the registry.
+        std::vector<Entity> residentEntities;
+    };
+
+    /// Integer value representing the side of a chunk, in tiles.
+    int chunkSize;
+    /// Tilemap object holding the tile ids of the whole world.
+    Tilemap tilemap;
+    /// LevelTilemapDescription object holding how the tiles are drawn.
+    LevelTilemapDescription tilemapDescription;
+    /// Vector of the descriptions of the streamed entities.
+    std::vector<LevelEntityDescription> entities;
+    /// Vector of the Lua functions of the streamed entities.
+    std::vector<LevelEntityScripts> entityScripts;
+    /// Vector of the destruction status, in game, of the streamed entities.
+    std::vector<bool> isEntityDestroyed;
+    /// Integer value representing the number of chunks along the x axis.
+    int numChunksX = 0;
+    /// Integer value representing the number of chunks along the y axis.
+    int numChunksY = 0;
+    /// Float value representing the side of a chunk, in world units.
+    float chunkWorldSize = 1.0f;
+    /// Vector of every chunk of the world.
+    /// @details chunks[index = chunk y * numChunksX + chunk x]
+    std::vector<Chunk> chunks;
+    /// Vector of the indices of the active chunks.
+    std::vector<int> activeChunks;
+    /// Vector of the indices of the chunks being prepared or prepared, but not active.
+    std::vector<int> pendingChunks;
+    /// Integer value representing the generation of the world, increased on every new world.
+    unsigned int worldGeneration = 0;
+    /// Vector of the tiles prepared by the worker, with their chunk index and world generation.
+    std::vector<std::pair<std::pair<int, unsigned int>, std::vector<TileSpawn>>> preparedTiles;
+    /// Mutex guarding the prepared tiles.
+    std::mutex preparedTilesMutex;
+    /// SDL Rectangle object defining the camera canvas at the previous update, to follow its direction of travel.
+    SDL_Rect previousCamera = {0, 0, 0, 0};
+    /// Job system preparing the chunks ahead of the camera, declared last so its worker stops first.
+    std::unique_ptr<JobSystem> jobSystem;
+
+    /// @brief Chunk range getter
+    /// @details Compute the chunks overlapped by the given world area, clamped to the world.
+    /// @return The range of the chunks, empty if the area is out of the world.
+    ChunkRange GetChunkRange(float x, float y, float w, float h) const;
+
+    /// @brief Check the membership of a chunk in a range
+    bool IsInRange(int chunkIndex, const ChunkRange& range) const;
+
+    /// @brief Chunk index getter
+    /// @return The index of the chunk holding the given world position, clamped to the world.
+    int GetChunkIndex(glm::vec2 position) const;
+
+    /// @brief Build the tiles of a chunk
+    /// @details Reads the tilemap only, so that it can run on the worker thread.
+    std::vector<TileSpawn> BuildTiles(int chunkIndex) const;
+
+    /// @brief Activate a chunk, creating its tiles and entities
+    void ActivateChunk(Registry& registry, int chunkIndex);
+
+    /// @brief Move an entity description from a chunk to another, activated with the latter from now on
+    void MoveEntityDescription(int descriptionIndex, int fromChunkIndex, int toChunkIndex);
+
+    /// @brief Write the state an entity changed in game back to its description
+    /// @details Only the position, rotation, velocity and health are kept.
+    void WriteBackEntity(Entity entity, int descriptionIndex);
+
+    /// @brief Deactivate a chunk, killing its entities but the ones standing in another active chunk
+    void DeactivateChunk(int chunkIndex);
+
+public:
+    /// @brief Default WorldStreamer constructor
+    /// @details Base constructor of the WorldStreamer class, streaming nothing.
+    /// @param chunkSize: Integer value representing the side of a chunk, in tiles.
+    explicit WorldStreamer(int chunkSize = DEFAULT_CHUNK_SIZE);
+
+    /// @brief Default WorldStreamer destructor
+    /// @details Base destructor of the WorldStreamer class, waiting for the chunks being prepared.
+    ~WorldStreamer();
+
+    WorldStreamer(const WorldStreamer&) = delete;
+    WorldStreamer& operator=(const WorldStreamer&) = delete;
+
+    /// @brief Set the world to stream
+    /// @details This method is responsible for partitioning a new world into chunks, replacing the previous one whose
+    /// entities must have been killed already. Nothing is created until the next update.
+    /// @param worldTilemap: Tilemap object holding the tile ids of the world.
+    /// @param worldTilemapDescription: LevelTilemapDescription object holding how the tiles are drawn.
+    /// @param worldEntities: Vector of the descriptions of the entities to stream, placed by their transform.
+    /// @param worldEntityScripts: Vector of the Lua functions of the entities to stream.
+    void SetWorld(Tilemap worldTilemap, const LevelTilemapDescription& worldTilemapDescription,
+                  std::vector<LevelEntityDescription> worldEntities, std::vector<LevelEntityScripts> worldEntityScripts);
+
+    /// @brief Update the active chunks
+    /// @details This method is responsible for activating the chunks near the camera, deactivating the ones far from
+    /// it and preparing the ones ahead of its direction of travel.
+    /// @param camera: SDL Rectangle object defining the camera canvas.
+    void Update(Registry& registry, const SDL_Rect& camera);
+
+    /// @brief Forget a streamed entity leaving the registry
+    /// @param entity: The entity leaving the registry.
+    /// @param streamed: The StreamedComponent of the entity.
+    void OnEntityRemoved(Entity entity, const StreamedComponent& streamed);
+
+    /// @brief Number of active chunks getter
+    std::size_t GetNumActiveChunks() const;
+};
+
+#endif // WORLDSTREAMER_H //
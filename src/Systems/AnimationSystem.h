@@ -19,9 +19,15 @@ public:
     }
 
     /// @brief System update animation method
-    /// @details This method is responsible for updating the animation frame on all its entities when called.
-    void Update() {
-        for (auto entity: GetSystemEntities()) {
+    /// @details This method is responsible for updating the animation frame on all its visible entities when called.
+    /// Frames are derived from the animation start time, so skipping off-screen entities loses nothing.
+    /// @param visibleEntities: The entities visible through the camera during the current frame.
+    void Update(const std::vector<Entity>& visibleEntities) {
+        for (auto entity: visibleEntities) {
+            if (!entity.HasComponent<AnimationComponent>()) {
+                continue;
+            }
+
             auto& animation = entity.GetComponent<AnimationComponent>();
             auto& sprite = entity.GetComponent<SpriteComponent>();
 
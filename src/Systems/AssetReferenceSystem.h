@@ -0,0 +1,50 @@
+#ifndef ASSETREFERENCESYSTEM_H
+#define ASSETREFERENCESYSTEM_H
+
+#include "../ECS/ECS.h"
+#include "../AssetStore/AssetStore.h"
+#include <string>
+#include <unordered_map>
+
+/// Template class responsible for counting the references from the components of type TComponent to the assets.
+/// @details An asset is acquired when an entity owning the component joins the system and released when it leaves it,
+/// so that the asset store knows which assets are safe to evict. The component type needs an assetId attribute;
+/// the asset id it holds when the entity is created is the one counted.
+/// @file AssetReferenceSystem.h
+/// @author Maxime Héliot
+/// @version 0.1.0 18/10/2026
+template <typename TComponent>
+class AssetReferenceSystem: public System {
+private:
+    /// Reference to the asset store counting the references.
+    AssetStore& assetStore;
+    /// Map of the asset id acquired for each entity id.
+    std::unordered_map<int, std::string> acquiredAssetIds;
+
+public:
+    /// @brief Default AssetReferenceSystem constructor
+    /// @details Base constructor of the AssetReferenceSystem class, defining the different required components an entity needs so the system can be interested in.
+    /// @param assetStore: The asset store to count the references in.
+    explicit AssetReferenceSystem(AssetStore& assetStore): assetStore(assetStore) {
+        RequireComponent<TComponent>();
+    }
+
+protected:
+    /// @brief Acquire the asset of an entity joining the system
+    void OnEntityAdded(Entity entity) override {
+        const auto& assetId = entity.GetComponent<TComponent>().assetId;
+        acquiredAssetIds[entity.GetId()] = assetId;
+        assetStore.AcquireAsset(assetId);
+    }
+
+    /// @brief Release the asset acquired for an entity leaving the system
+    void OnEntityRemoved(Entity entity) override {
+        auto acquiredAssetId = acquiredAssetIds.find(entity.GetId());
+        if (acquiredAssetId != acquiredAssetIds.end()) {
+            assetStore.ReleaseAsset(acquiredAssetId->second);
+            acquiredAssetIds.erase(acquiredAssetId);
+        }
+    }
+};
+
+#endif // ASSETREFERENCESYSTEM_H //
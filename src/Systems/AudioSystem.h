@@ -0,0 +1,236 @@
+#ifndef AUDIOSYSTEM_H
+#define AUDIOSYSTEM_H
+
+#include "../ECS/ECS.h"
+#include "../AssetStore/AssetStore.h"
+#include "../EventBus/EventBus.h"
+#include "../Events/PlaySoundEvent.h"
+#include "../Components/TransformComponent.h"
+#include "../Components/SoundEmitterComponent.h"
+#include <SDL.h>
+#include <SDL_mixer.h>
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+/// Integer value representing the number of voices, one mixer channel each, the sounds are played on.
+const int NUM_AUDIO_VOICES = 16;
+/// Float value representing the distance to the camera view, in pixels, past which a sound is not played.
+const float AUDIBLE_DISTANCE = 600.0f;
+/// Integer value representing the maximum number of one shot sounds queued between two updates.
+const std::size_t MAX_PENDING_SOUNDS = 64;
+
+/// Class responsible for playing the sounds of the game on a fixed pool of voices.
+/// @details One shot sounds are requested through PlaySoundEvent, looping ones follow the entities owning a
+/// SoundEmitterComponent. Sounds too far from the camera are culled, the requests of the same sound within an update
+/// are merged into the closest one, and when every voice is busy a sound only plays by stealing the voice of a lower
+/// priority one. The number of mixer channels therefore never grows, however many projectiles are shot.
+/// @file AudioSystem.h
+/// @author Maxime Héliot
+/// @version 0.1.0 18/10/2026
+class AudioSystem: public System {
+private:
+    /// Structure holding the state of a voice of the pool.
+    struct Voice {
+        /// String object representing the id of the sound asset played, empty when the voice is free.
+        std::string assetId;
+        /// Integer value representing the priority of the sound played.
+        int priority = 0;
+        /// Integer value representing the id of the entity the looping sound follows, -1 for a one shot sound.
+        int entityId = -1;
+        /// Integer value representing the time the sound started, in milliseconds.
+        Uint32 startTime = 0;
+    };
+
+    /// Array of the voices, indexed by mixer channel.
+    std::array<Voice, NUM_AUDIO_VOICES> voices;
+    /// Vector of the one shot sounds requested since the last update.
+    std::vector<PlaySoundEvent> pendingSounds;
+
+public:
+    /// @brief Default AudioSystem constructor
+    /// @details Base constructor of the AudioSystem class, defining the different required components an entity needs so the system can be interested in.
+    AudioSystem() {
+        RequireComponent<TransformComponent>();
+        RequireComponent<SoundEmitterComponent>();
+        pendingSounds.reserve(MAX_PENDING_SOUNDS);
+    }
+
+    /// @brief Event subscribing method
+    /// @details This method is responsible for subscribing the class to its interested events.
+    void SubscribeToEvents(std::unique_ptr<EventBus>& eventBus) {
+        eventBus->SubscribeEvent<PlaySoundEvent>(this, &AudioSystem::OnPlaySound);
+    }
+
+    /// @brief On play sound event handler
+    /// @details This method is responsible for queuing a one shot sound until the next update.
+    void OnPlaySound(PlaySoundEvent& event) {
+        if (pendingSounds.size() < MAX_PENDING_SOUNDS) {
+            pendingSounds.push_back(event);
+        }
+    }
+
+    /// @brief System update audio method
+    /// @details This method is responsible for starting, updating and stopping the voices according to the camera view.
+    /// @param assetStore: The asset store holding the sound chunks.
+    /// @param camera: SDL Rectangle object defining the camera canvas the sounds are heard from.
+    void Update(std::unique_ptr<AssetStore>& assetStore, const SDL_Rect& camera) {
+        if (!Mix_QuerySpec(nullptr, nullptr, nullptr)) {
+            pendingSounds.clear();
+            return;
+        }
+
+        // Free the voices whose one shot sound is over
+        for (int channel = 0; channel < NUM_AUDIO_VOICES; channel++) {
+            if (!voices[channel].assetId.empty() && !Mix_Playing(channel)) {
+                voices[channel] = Voice();
+            }
+        }
+
+        // Keep the looping sounds of the emitters in range playing, stop the others
+        for (auto entity: GetSystemEntities()) {
+            const auto& soundEmitter = entity.GetComponent<SoundEmitterComponent>();
+            const glm::vec2 position = entity.GetComponent<TransformComponent>().position;
+            const float distance = GetDistanceToCamera(position, camera);
+            const int channel = FindEntityVoice(entity.GetId());
+
+            if (distance > AUDIBLE_DISTANCE) {
+                if (channel >= 0) {
+                    StopVoice(channel);
+                }
+            } else if (channel >= 0) {
+                SetVoiceSpatialization(channel, position, distance, soundEmitter.volume, camera);
+            } else {
+                PlayVoice(assetStore->GetSound(soundEmitter.assetId), soundEmitter.assetId, soundEmitter.priority,
+                          entity.GetId(), position, distance, soundEmitter.volume, camera);
+            }
+        }
+
+        // Merge the requests of a same sound into the closest one, then play what is in range
+        for (std::size_t i = 0; i < pendingSounds.size(); i++) {
+            const auto& sound = pendingSounds[i];
+            const float distance = GetDistanceToCamera(sound.position, camera);
+            if (distance > AUDIBLE_DISTANCE) {
+                continue;
+            }
+            bool isMerged = false;
+            for (std::size_t j = 0; j < pendingSounds.size() && !isMerged; j++) {
+                if (j != i && pendingSounds[j].assetId == sound.assetId) {
+                    const float otherDistance = GetDistanceToCamera(pendingSounds[j].position, camera);
+                    isMerged = otherDistance < distance || (otherDistance == distance && j < i);
+                }
+            }
+            if (!isMerged) {
+                PlayVoice(assetStore->GetSound(sound.assetId), sound.assetId, sound.priority, -1, sound.position,
+                          distance, MIX_MAX_VOLUME, camera);
+            }
+        }
+        pendingSounds.clear();
+    }
+
+    /// @brief Play a music
+    /// @details This method is responsible for streaming the given music in a loop, replacing the current one.
+    /// @param music: The music to play, nullptr to stop the current one.
+    /// @param volume: Integer value representing the volume of the music, from 0 to 128.
+    void PlayMusic(Mix_Music* music, int volume = MIX_MAX_VOLUME) {
+        if (!Mix_QuerySpec(nullptr, nullptr, nullptr)) {
+            return;
+        }
+        Mix_HaltMusic();
+        if (music) {
+            Mix_VolumeMusic(volume);
+            Mix_PlayMusic(music, -1);
+        }
+    }
+
+protected:
+    /// @brief Stop the looping sound of an entity leaving the system
+    void OnEntityRemoved(Entity entity) override {
+        const int channel = FindEntityVoice(entity.GetId());
+        if (channel >= 0) {
+            StopVoice(channel);
+        }
+    }
+
+private:
+    /// @brief Distance to the camera view
+    /// @return The distance between the given world position and the closest point of the camera view, zero inside it.
+    static float GetDistanceToCamera(const glm::vec2& position, const SDL_Rect& camera) {
+        const float dx = std::max({static_cast<float>(camera.x) - position.x, 0.0f, position.x - static_cast<float>(camera.x + camera.w)});
+        const float dy = std::max({static_cast<float>(camera.y) - position.y, 0.0f, position.y - static_cast<float>(camera.y + camera.h)});
+        return std::sqrt(dx * dx + dy * dy);
+    }
+
+    /// @brief Looping voice lookup
+    /// @return The channel of the voice looping the sound of the given entity, -1 if there is none.
+    int FindEntityVoice(int entityId) const {
+        for (int channel = 0; channel < NUM_AUDIO_VOICES; channel++) {
+            if (voices[channel].entityId == entityId && !voices[channel].assetId.empty()) {
+                return channel;
+            }
+        }
+        return -1;
+    }
+
+    /// @brief Stop a voice
+    void StopVoice(int channel) {
+        Mix_HaltChannel(channel);
+        voices[channel] = Voice();
+    }
+
+    /// @brief Update the volume and stereo position of a voice
+    /// @details The volume fades out with the distance to the camera view and the sound is panned according to its
+    /// horizontal position relative to the camera center.
+    static void SetVoiceSpatialization(int channel, const glm::vec2& position, float distance, int volume, const SDL_Rect& camera) {
+        const float attenuation = 1.0f - distance / AUDIBLE_DISTANCE;
+        Mix_Volume(channel, static_cast<int>(volume * attenuation));
+
+        const float halfWidth = camera.w / 2.0f + AUDIBLE_DISTANCE;
+        const float pan = std::clamp((position.x - (camera.x + camera.w / 2.0f)) / halfWidth, -1.0f, 1.0f);
+        Mix_SetPanning(channel, static_cast<Uint8>(255 * std::min(1.0f, 1.0f - pan)), static_cast<Uint8>(255 * std::min(1.0f, 1.0f + pan)));
+    }
+
+    /// @brief Play a sound on a voice
+    /// @details This method is responsible for playing a sound on a free voice, or by stealing the voice of the lowest
+    /// priority sound, the oldest first, when every voice is busy. Looping sounds are never stolen by an equal priority.
+    void PlayVoice(Mix_Chunk* chunk, const std::string& assetId, int priority, int entityId, const glm::vec2& position,
+                   float distance, int volume, const SDL_Rect& camera) {
+        if (!chunk) {
+            return;
+        }
+
+        int channel = -1;
+        for (int i = 0; i < NUM_AUDIO_VOICES; i++) {
+            const auto& voice = voices[i];
+            if (voice.assetId.empty()) {
+                channel = i;
+                break;
+            }
+            const bool canSteal = voice.priority < priority || (voice.priority == priority && voice.entityId < 0 && entityId < 0);
+            if (canSteal && (channel < 0 || voice.priority < voices[channel].priority ||
+                             (voice.priority == voices[channel].priority && voice.startTime < voices[channel].startTime))) {
+                channel = i;
+            }
+        }
+        if (channel < 0) {
+            return;
+        }
+
+        Mix_HaltChannel(channel);
+        SetVoiceSpatialization(channel, position, distance, volume, camera);
+        if (Mix_PlayChannel(channel, chunk, entityId >= 0 ? -1 : 0) < 0) {
+            voices[channel] = Voice();
+            return;
+        }
+        voices[channel].assetId = assetId;
+        voices[channel].priority = priority;
+        voices[channel].entityId = entityId;
+        voices[channel].startTime = SDL_GetTicks();
+    }
+};
+
+#endif // AUDIOSYSTEM_H //
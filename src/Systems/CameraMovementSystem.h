@@ -33,11 +33,11 @@ public:
                 camera.y = transform.position.y - (Game::windowHeight / 2);
             }
 
-            // Keep the camera rectangle view inside the screen limits
+            // Keep the camera rectangle view inside the map limits
+            camera.x = camera.x > Game::mapWidth - camera.w ? Game::mapWidth - camera.w : camera.x;
+            camera.y = camera.y > Game::mapHeight - camera.h ? Game::mapHeight - camera.h : camera.y;
             camera.x = camera.x < 0 ? 0 : camera.x;
             camera.y = camera.y < 0 ? 0 : camera.y;
-            camera.x = camera.x > camera.w ? camera.w : camera.x;
-            camera.y = camera.y > camera.h ? camera.h : camera.y;
         }
     }
 
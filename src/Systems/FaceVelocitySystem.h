@@ -0,0 +1,51 @@
+#ifndef FACEVELOCITYSYSTEM_H
+#define FACEVELOCITYSYSTEM_H
+
+#include "../ECS/ECS.h"
+#include "../Components/TransformComponent.h"
+#include "../Components/ProjectileEmitterComponent.h"
+#include "../Components/FaceVelocityComponent.h"
+#include <glm/glm.hpp>
+#include <cmath>
+
+/// Class responsible to turn the entities towards the direction they move in, in place of their Lua scripts.
+/// @details The direction is the one of the move of the current tick, whatever moved the entity: its rigid body,
+/// a motion component or a script.
+/// @file FaceVelocitySystem.h
+/// @author Maxime Héliot
+/// @version 0.1.0 18/10/2026
+class FaceVelocitySystem: public System {
+public:
+    /// @brief Default FaceVelocitySystem constructor
+    /// @details Base constructor of the FaceVelocitySystem class, defining the different required components an entity needs so the system can be interested in.
+    FaceVelocitySystem() {
+        RequireComponent<TransformComponent>();
+        RequireComponent<FaceVelocityComponent>();
+    }
+
+    /// @brief System update facing method
+    /// @details This method is responsible for setting the rotation of all its entities that moved during the tick,
+    /// and the direction of their projectiles when aiming.
+    void Update() {
+        for (auto entity: GetSystemEntities()) {
+            auto& transform = entity.GetComponent<TransformComponent>();
+            const auto& face = entity.GetComponent<FaceVelocityComponent>();
+
+            // Standing still keeps the last direction
+            const glm::vec2 move = transform.position - transform.previousPosition;
+            const float moveLength = glm::length(move);
+            if (moveLength < 1e-4f) {
+                continue;
+            }
+
+            transform.rotation.x = glm::degrees(std::atan2(move.x, -move.y)) + face.angleOffset;
+
+            if (face.isAimingProjectiles && entity.HasComponent<ProjectileEmitterComponent>()) {
+                auto& projectileEmitter = entity.GetComponent<ProjectileEmitterComponent>();
+                projectileEmitter.projectileVelocity = move / moveLength * glm::length(projectileEmitter.projectileVelocity);
+            }
+        }
+    }
+};
+
+#endif // FACEVELOCITYSYSTEM_H //
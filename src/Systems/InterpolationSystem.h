@@ -0,0 +1,29 @@
+#ifndef INTERPOLATIONSYSTEM_H
+#define INTERPOLATIONSYSTEM_H
+
+#include "../ECS/ECS.h"
+#include "../Components/TransformComponent.h"
+
+/// Class responsible to keep the transform state of the previous simulation tick, so that rendering can interpolate.
+/// @file InterpolationSystem.h
+/// @author Maxime Héliot
+/// @version 0.1.0 18/10/2026
+class InterpolationSystem: public System {
+public:
+    /// @brief Default InterpolationSystem constructor
+    /// @details Base constructor of the InterpolationSystem class, defining the different required components an entity needs so the system can be interested in.
+    InterpolationSystem() {
+        RequireComponent<TransformComponent>();
+    }
+
+    /// @brief System update interpolation method
+    /// @details This method is responsible for saving the current position of all its entities, before a new tick moves them.
+    void Update() {
+        for (auto entity: GetSystemEntities()) {
+            auto& transform = entity.GetComponent<TransformComponent>();
+            transform.previousPosition = transform.position;
+        }
+    }
+};
+
+#endif // INTERPOLATIONSYSTEM_H //
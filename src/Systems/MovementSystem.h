@@ -68,6 +68,7 @@ public:
             // Update entity position based on it's velocity
             auto& transform = entity.GetComponent<TransformComponent>();
             const auto rigidBody = entity.GetComponent<RigidBodyComponent>();
+            const glm::vec2 previousPosition = transform.position;
 
             transform.position.x += rigidBody.velocity.x * deltaTime;
             transform.position.y += rigidBody.velocity.y * deltaTime;
@@ -84,6 +85,11 @@ public:
                 transform.position.y = transform.position.y > Game::mapHeight - paddingBottom ? Game::mapHeight - paddingBottom : transform.position.y;
             }
 
+            // Resting entities keep their place in the visibility index
+            if (transform.position != previousPosition) {
+                transform.isDirty = true;
+            }
+
             // Check if entity is outside the map boundaries (with a 100 pixels forgiving margin)
             int margin = 100;
 
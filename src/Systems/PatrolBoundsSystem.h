@@ -0,0 +1,46 @@
+#ifndef PATROLBOUNDSSYSTEM_H
+#define PATROLBOUNDSSYSTEM_H
+
+#include "../ECS/ECS.h"
+#include "../Game/Game.h"
+#include "../Components/TransformComponent.h"
+#include "../Components/RigidBodyComponent.h"
+#include "../Components/PatrolBoundsComponent.h"
+
+/// Class responsible to turn the patrolling entities back at the edges of their area, in place of their Lua scripts.
+/// @file PatrolBoundsSystem.h
+/// @author Maxime Héliot
+/// @version 0.1.0 18/10/2026
+class PatrolBoundsSystem: public System {
+public:
+    /// @brief Default PatrolBoundsSystem constructor
+    /// @details Base constructor of the PatrolBoundsSystem class, defining the different required components an entity needs so the system can be interested in.
+    PatrolBoundsSystem() {
+        RequireComponent<TransformComponent>();
+        RequireComponent<RigidBodyComponent>();
+        RequireComponent<PatrolBoundsComponent>();
+    }
+
+    /// @brief System update patrol method
+    /// @details This method is responsible for flipping, axis by axis, the velocity of the entities out of their area
+    /// and still moving away from it, once moved for the tick.
+    void Update() {
+        const glm::vec2 mapSize(Game::mapWidth, Game::mapHeight);
+        for (auto entity: GetSystemEntities()) {
+            const auto& transform = entity.GetComponent<TransformComponent>();
+            const auto& bounds = entity.GetComponent<PatrolBoundsComponent>();
+            auto& rigidBody = entity.GetComponent<RigidBodyComponent>();
+
+            const glm::vec2 minPosition = bounds.nearMargin;
+            const glm::vec2 maxPosition = mapSize - bounds.farMargin;
+            for (int axis = 0; axis < 2; axis++) {
+                if ((transform.position[axis] < minPosition[axis] && rigidBody.velocity[axis] < 0) ||
+                    (transform.position[axis] > maxPosition[axis] && rigidBody.velocity[axis] > 0)) {
+                    rigidBody.velocity[axis] *= -1;
+                }
+            }
+        }
+    }
+};
+
+#endif // PATROLBOUNDSSYSTEM_H //
@@ -4,6 +4,7 @@
 #include "../ECS/ECS.h"
 #include "../EventBus/EventBus.h"
 #include "../Events/KeyPressedEvent.h"
+#include "../Events/PlaySoundEvent.h"
 #include "../Components/TransformComponent.h"
 #include "../Components/SpriteComponent.h"
 #include "../Components/RigidBodyComponent.h"
@@ -18,6 +19,18 @@
 /// @author Maxime Héliot
 /// @version 0.1.0 19/10/2021
 class ProjectileEmitSystem: public System {
+private:
+    /// Pointer to the event bus the shot sounds are requested on, set by the events subscription.
+    EventBus* eventBus = nullptr;
+
+    /// @brief Request the sound of a shot
+    /// @details This method is responsible for requesting the sound of the given emitter, if any, at the projectile position.
+    void PlayShotSound(const ProjectileEmitterComponent& projectileEmitter, const glm::vec2& projectilePosition) {
+        if (eventBus && !projectileEmitter.soundAssetId.empty()) {
+            eventBus->EmitEvent<PlaySoundEvent>(projectileEmitter.soundAssetId, projectilePosition, projectileEmitter.soundPriority);
+        }
+    }
+
 public:
     /// @brief Default ProjectileEmitSystem constructor
     /// @details Base constructor of the ProjectileEmitSystem class, defining the different required components an entity needs so the system can be interested in.
@@ -29,6 +42,7 @@ public:
     /// @brief Event subscribing method
     /// @details This method is responsible for subscribing the class to its interested events.
     void SubscribeToEvents(std::unique_ptr<EventBus>& eventBus) {
+        this->eventBus = eventBus.get();
         eventBus->SubscribeEvent<KeyPressedEvent>(this, &ProjectileEmitSystem::OnKeyPressed);
     }
 
@@ -69,7 +83,7 @@ public:
                     projectile.AddComponent<SpriteComponent>("bullet-texture", 4, 4, 4);
                     projectile.AddComponent<BoxColliderComponent>(4, 4);
                     projectile.AddComponent<ProjectileComponent>(projectileEmitter.isFriendly, projectileEmitter.hitPercentDamage, projectileEmitter.projectileDuration);
-
+                    PlayShotSound(projectileEmitter, projectilePosition);
                 }
             }
         }
@@ -104,6 +118,7 @@ public:
                 projectile.AddComponent<SpriteComponent>("bullet-texture", 4, 4, 4);
                 projectile.AddComponent<BoxColliderComponent>(4, 4);
                 projectile.AddComponent<ProjectileComponent>(projectileEmitter.isFriendly, projectileEmitter.hitPercentDamage, projectileEmitter.projectileDuration);
+                PlayShotSound(projectileEmitter, projectilePosition);
 
                 // Update the projectile emitter component last emission to the current miliseconds
                 projectileEmitter.lastEmissionTime = SDL_GetTicks();
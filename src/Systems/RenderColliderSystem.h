@@ -4,6 +4,7 @@
 #include "../ECS/ECS.h"
 #include "../Components/BoxColliderComponent.h"
 #include "../Components/TransformComponent.h"
+#include "../Renderer/RenderSnapshot.h"
 
 /// Class responsible to render collider bounds of entities.
 /// @file RenderColliderSystem.h
@@ -19,22 +20,31 @@ public:
     }
 
     /// @brief System update render collider method
-    /// @details This method is responsible for updating the collider render on all its interested entities when called.
-    void Update(SDL_Renderer* renderer, SDL_Rect& camera) {
+    /// @details This method is responsible for updating the collider render on all its interested entities when called,
+    /// skipping the boxes lying outside the camera view.
+    /// @param snapshot: The render snapshot of the current frame.
+    /// @param camera: SDL Rectangle object defining the camera canvas.
+    /// @param alpha: Double value between 0 and 1 representing the progress between the previous and the current tick.
+    void Update(RenderSnapshot& snapshot, const SDL_Rect& camera, double alpha) {
         for (auto entity: GetSystemEntities())
         {
-            const auto transform = entity.GetComponent<TransformComponent>();
-            const auto collider = entity.GetComponent<BoxColliderComponent>();
+            const auto& transform = entity.GetComponent<TransformComponent>();
+            const auto& collider = entity.GetComponent<BoxColliderComponent>();
 
+            const glm::vec2 position = transform.GetInterpolatedPosition(alpha);
             SDL_Rect colliderRect = {
-                    static_cast<int>(transform.position.x + collider.offset.x - camera.x),
-                    static_cast<int>(transform.position.y + collider.offset.y - camera.y),
+                    static_cast<int>(position.x + collider.offset.x - camera.x),
+                    static_cast<int>(position.y + collider.offset.y - camera.y),
                     static_cast<int>(collider.width * transform.scale.x),
                     static_cast<int>(collider.height * transform.scale.y)
             };
 
-            SDL_SetRenderDrawColor(renderer, 255, 0, 0, 255);
-            SDL_RenderDrawRect(renderer, &colliderRect);
+            if (colliderRect.x + colliderRect.w < 0 || colliderRect.x > camera.w ||
+                colliderRect.y + colliderRect.h < 0 || colliderRect.y > camera.h) {
+                continue;
+            }
+
+            snapshot.AddRect(colliderRect, {255, 0, 0, 255}, false);
         }
     }
 };
@@ -8,6 +8,9 @@
 #include "../Components/BoxColliderComponent.h"
 #include "../Components/ProjectileEmitterComponent.h"
 #include "../Components/HealthComponent.h"
+#include "../Scripting/LuaHeap.h"
+#include "../Scripting/ScriptProfiler.h"
+#include <algorithm>
 #include <imgui/imgui.h>
 #include <imgui/imgui_sdl.h>
 
@@ -18,7 +21,7 @@ public:
     RenderGUISystem() = default;
 
     /// TODO: comments
-    void Update(const std::unique_ptr<Registry>& registry, SDL_Rect& camera) {
+    void Update(const std::unique_ptr<Registry>& registry, SDL_Rect& camera, const LuaHeapStats& luaStats, ScriptProfiler& scriptProfiler) {
         ImGui::NewFrame();
 
         if (ImGui::Begin("Spawn enemies")) {
@@ -116,6 +119,62 @@ public:
         }
         ImGui::End();
 
+        // Display the memory metrics of the scripts under the map coordinates
+        ImGui::SetNextWindowPos(ImVec2(10, 50), ImGuiCond_Always, ImVec2(0, 0));
+        ImGui::SetNextWindowBgAlpha(0.9f);
+        if (ImGui::Begin("Lua memory", NULL, windowFlags)) {
+            ImGui::Text("Lua memory: %.1f KB in use, %.1f KB of pages", luaStats.bytesInUse / 1024.0, luaStats.bytesInPages / 1024.0);
+            ImGui::Text("Lua allocations: %llu (%llu small), %llu frees",
+                        static_cast<unsigned long long>(luaStats.numAllocations),
+                        static_cast<unsigned long long>(luaStats.numSmallAllocations),
+                        static_cast<unsigned long long>(luaStats.numFrees));
+            ImGui::Text("Lua GC: %llu cycles, last step %.3f ms, longest %.3f ms, total %.1f ms",
+                        static_cast<unsigned long long>(luaStats.numGcCycles),
+                        luaStats.lastGcTime, luaStats.maxGcTime, luaStats.totalGcTime);
+        }
+        ImGui::End();
+
+        // Display the most expensive scripts while profiling, 'p' toggling the profiler
+        if (scriptProfiler.IsEnabled() || scriptProfiler.GetNumSamples() > 0) {
+            if (ImGui::Begin("Script profiler")) {
+                ImGui::Text("%s, %llu samples every %d instructions", scriptProfiler.IsEnabled() ? "Profiling" : "Stopped",
+                            static_cast<unsigned long long>(scriptProfiler.GetNumSamples()), scriptProfiler.GetSampleCount());
+                if (ImGui::Button("Export JSON")) {
+                    scriptProfiler.ExportJson(SCRIPT_PROFILE_FILE_PATH);
+                }
+                ImGui::SameLine();
+                if (ImGui::Button("Reset")) {
+                    scriptProfiler.Reset();
+                }
+
+                const auto functions = scriptProfiler.GetFunctionTimings();
+                ImGui::Separator();
+                ImGui::Text("Functions: total ms, calls, max ms");
+                for (std::size_t i = 0; i < std::min<std::size_t>(functions.size(), 10); i++) {
+                    const ScriptTiming& timing = functions[i].second;
+                    ImGui::Text("%8.2f %8llu %6.3f  %s", timing.totalTime, static_cast<unsigned long long>(timing.numCalls),
+                                timing.maxTime, functions[i].first.c_str());
+                }
+
+                const auto entities = scriptProfiler.GetEntityTimings();
+                ImGui::Separator();
+                ImGui::Text("Entities: total ms, calls, max ms");
+                for (std::size_t i = 0; i < std::min<std::size_t>(entities.size(), 10); i++) {
+                    const ScriptTiming& timing = entities[i].second;
+                    ImGui::Text("%8.2f %8llu %6.3f  entity %d", timing.totalTime, static_cast<unsigned long long>(timing.numCalls),
+                                timing.maxTime, entities[i].first);
+                }
+
+                const auto stacks = scriptProfiler.GetStackSamples();
+                ImGui::Separator();
+                ImGui::Text("Sampled stacks");
+                for (std::size_t i = 0; i < std::min<std::size_t>(stacks.size(), 5); i++) {
+                    ImGui::TextWrapped("%llu  %s", static_cast<unsigned long long>(stacks[i].second), stacks[i].first.c_str());
+                }
+            }
+            ImGui::End();
+        }
+
         ImGui::Render();
         ImGuiSDL::Render(ImGui::GetDrawData());
     }
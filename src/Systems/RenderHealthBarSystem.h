@@ -3,6 +3,7 @@
 
 #include "../ECS/ECS.h"
 #include "../AssetStore/AssetStore.h"
+#include "../Renderer/RenderSnapshot.h"
 #include "../Components/TransformComponent.h"
 #include "../Components/SpriteComponent.h"
 #include "../Components/HealthComponent.h"
@@ -24,11 +25,19 @@ public:
 
     /// @brief System update health render method
     /// @details This method is responsible for managing entity health display at any frame of the game.
-    void Update(SDL_Renderer* renderer, std::unique_ptr<AssetStore>& assetStore, const SDL_Rect& camera) {
-        for (auto entity: GetSystemEntities()) {
-            const auto transform = entity.GetComponent<TransformComponent>();
-            const auto sprite = entity.GetComponent<SpriteComponent>();
-            const auto health = entity.GetComponent<HealthComponent>();
+    /// @param snapshot: The render snapshot of the current frame.
+    /// @param visibleEntities: The entities visible through the camera during the current frame.
+    /// @param alpha: Double value between 0 and 1 representing the progress between the previous and the current tick.
+    void Update(RenderSnapshot& snapshot, std::unique_ptr<AssetStore>& assetStore, const SDL_Rect& camera, const std::vector<Entity>& visibleEntities, double alpha) {
+        for (auto entity: visibleEntities) {
+            // Visible entities always have a transform and a sprite, only the health still needs checking
+            if (!entity.HasComponent<HealthComponent>()) {
+                continue;
+            }
+
+            const auto& transform = entity.GetComponent<TransformComponent>();
+            const auto& sprite = entity.GetComponent<SpriteComponent>();
+            const auto& health = entity.GetComponent<HealthComponent>();
 
             // Draw the health bar with the correct color for the percentage
             SDL_Color healthBarColor = {255, 255, 255};
@@ -51,8 +60,9 @@ public:
             // Position the health bar indicator in the top-right part of the entity sprite
             int healthBarWidth = 15;
             int healthBarHeight = 3;
-            double healthBarPosX = (transform.position.x + (sprite.width * transform.scale.x)) - camera.x;
-            double healthBarPosY = (transform.position.y) - camera.y;
+            const glm::vec2 position = transform.GetInterpolatedPosition(alpha);
+            double healthBarPosX = (position.x + (sprite.width * transform.scale.x)) - camera.x;
+            double healthBarPosY = (position.y) - camera.y;
 
             SDL_Rect healthBarRectangle = {
                 static_cast<int>(healthBarPosX),
@@ -60,28 +70,11 @@ public:
                 static_cast<int>(healthBarWidth * (health.healthPercentage / 100.0)),
                 static_cast<int>(healthBarHeight)
             };
-            SDL_SetRenderDrawColor(renderer, healthBarColor.r, healthBarColor.g, healthBarColor.b, 255);
-            SDL_RenderFillRect(renderer, &healthBarRectangle);
+            snapshot.AddRect(healthBarRectangle, healthBarColor, true);
 
             // Render the health percentage text label indicator
-            std::string healthText = std::to_string(health.healthPercentage);
-            SDL_Surface* surface = TTF_RenderText_Blended(assetStore->GetFont("pico8-font-5"), healthText.c_str(), healthBarColor);
-            SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-            SDL_FreeSurface(surface);
-
-            int labelWidth = 0;
-            int labelHeight = 0;
-            SDL_QueryTexture(texture, NULL, NULL, &labelWidth, &labelHeight);
-            SDL_Rect healthBarTextRectangle = {
-                static_cast<int>(healthBarPosX),
-                static_cast<int>(healthBarPosY) + 5,
-                labelWidth,
-                labelHeight
-            };
-
-            SDL_RenderCopy(renderer, texture, NULL, &healthBarTextRectangle);
-
-            SDL_DestroyTexture(texture);
+            snapshot.AddText(assetStore->GetFont("pico8-font-5"), std::to_string(health.healthPercentage), healthBarColor,
+                             static_cast<int>(healthBarPosX), static_cast<int>(healthBarPosY) + 5);
         }
     }
 };
@@ -5,6 +5,7 @@
 #include "../Components/TransformComponent.h"
 #include "../Components/SpriteComponent.h"
 #include "../AssetStore/AssetStore.h"
+#include "../Renderer/RenderSnapshot.h"
 #include <SDL.h>
 #include <algorithm>
 
@@ -22,58 +23,49 @@ public:
     }
 
     /// @brief System update render method
-    /// @details This method is responsible for updating the render on all its entities when called.
-    void Update(SDL_Renderer* renderer, std::unique_ptr<AssetStore>& assetStore, SDL_Rect& camera) {
-        // Create a vector with both Sprite and Transform component of all entities
+    /// @details This method is responsible for recording the sprite of all the visible entities in the render snapshot when called.
+    /// @param snapshot: The render snapshot of the current frame.
+    /// @param visibleEntities: The entities visible through the camera during the current frame.
+    /// @param alpha: Double value between 0 and 1 representing the progress between the previous and the current tick.
+    void Update(RenderSnapshot& snapshot, std::unique_ptr<AssetStore>& assetStore, const SDL_Rect& camera, const std::vector<Entity>& visibleEntities, double alpha) {
+        // Create a vector with both Sprite and Transform component of all visible entities
         struct RenderableEntity {
-            TransformComponent transformComponent;
-            SpriteComponent spriteComponent;
+            const TransformComponent* transformComponent;
+            const SpriteComponent* spriteComponent;
         };
         std::vector<RenderableEntity> renderableEntities;
-        for (auto entity: GetSystemEntities()) {
+        renderableEntities.reserve(visibleEntities.size());
+        for (auto entity: visibleEntities) {
             RenderableEntity renderableEntity;
-            renderableEntity.spriteComponent = entity.GetComponent<SpriteComponent>();
-            renderableEntity.transformComponent = entity.GetComponent<TransformComponent>();
-
-            // Bypass rendering entities if they're outside the camera view
-            bool isEntityOutsideCameraView = (
-                    renderableEntity.transformComponent.position.x + (renderableEntity.spriteComponent.width * renderableEntity.transformComponent.scale.x) < camera.x ||
-                    renderableEntity.transformComponent.position.x > camera.x + camera.w ||
-                    renderableEntity.transformComponent.position.y + (renderableEntity.spriteComponent.height * renderableEntity.transformComponent.scale.y) < camera.y ||
-                    renderableEntity.transformComponent.position.y > camera.y + camera.h
-                    );
-
-            // Cull sprites that are outside the camera view (and are not fixed)
-            if (isEntityOutsideCameraView && !renderableEntity.spriteComponent.isFixed) {
-                continue;
-            }
-
+            renderableEntity.spriteComponent = &entity.GetComponent<SpriteComponent>();
+            renderableEntity.transformComponent = &entity.GetComponent<TransformComponent>();
             renderableEntities.emplace_back(renderableEntity);
         }
 
         // Sort the vector by the z-index value
         std::sort(renderableEntities.begin(), renderableEntities.end(), [](const RenderableEntity& a, const RenderableEntity& b) -> bool {
-            return a.spriteComponent.layerIndex < b.spriteComponent.layerIndex;
+            return a.spriteComponent->layerIndex < b.spriteComponent->layerIndex;
         });
 
-        // Loop all entities that the system is interested in
-        for (auto entity: renderableEntities) {
-            const auto transform = entity.transformComponent;
-            const auto sprite = entity.spriteComponent;
+        // Loop all visible entities in their z-index order
+        for (const auto& entity: renderableEntities) {
+            const auto& transform = *entity.transformComponent;
+            const auto& sprite = *entity.spriteComponent;
 
-            // Set the source rectangle of our original sprite texture
-            SDL_Rect srcRect = sprite.srcRect;
+            // Set the source rectangle of our original sprite texture, the placeholder of a loading one being stretched over the sprite
+            SDL_Texture* texture = assetStore->GetTexture(sprite.assetId);
+            SDL_Rect srcRect = assetStore->IsPlaceholder(texture) ? SDL_Rect{0, 0, 1, 1} : sprite.srcRect;
 
             // Set the destination rectangle with the x, y position to be rendered
+            const glm::vec2 position = transform.GetInterpolatedPosition(alpha);
             SDL_Rect dstRect = {
-                    static_cast<int>(transform.position.x - (sprite.isFixed ? 0 : camera.x)),
-                    static_cast<int>(transform.position.y - (sprite.isFixed ? 0 : camera.y)),
+                    static_cast<int>(position.x - (sprite.isFixed ? 0 : camera.x)),
+                    static_cast<int>(position.y - (sprite.isFixed ? 0 : camera.y)),
                     static_cast<int>(sprite.width * transform.scale.x),
                     static_cast<int>(sprite.height * transform.scale.y)
             };
 
-            SDL_RenderCopyEx(renderer,
-                           assetStore->GetTexture(sprite.assetId), &srcRect, &dstRect, transform.rotation.x, NULL, sprite.flip);
+            snapshot.AddSprite(texture, srcRect, dstRect, transform.rotation.x, sprite.flip);
         }
     }
 };
@@ -2,8 +2,11 @@
 #define RENDERTEXTSYSTEM_H
 
 #include "../AssetStore/AssetStore.h"
+#include "../Renderer/RenderSnapshot.h"
 #include "../ECS/ECS.h"
 #include "../Components/TextLabelComponent.h"
+#include "../Components/SpriteComponent.h"
+#include "./VisibilitySystem.h"
 #include <SDL.h>
 
 /// Class responsible to process text label display to any entity its interested in.
@@ -20,29 +23,27 @@ public:
 
     /// @brief System update text display method
     /// @details This method is responsible for managing text label render at any frame of the game.
-    void Update(SDL_Renderer* renderer, std::unique_ptr<AssetStore>& assetStore, const SDL_Rect camera) {
+    /// @param snapshot: The render snapshot of the current frame.
+    /// @param visibility: The visibility system holding the entities visible during the current frame.
+    void Update(RenderSnapshot& snapshot, std::unique_ptr<AssetStore>& assetStore, const SDL_Rect camera, const VisibilitySystem& visibility) {
         for (auto entity: GetSystemEntities()) {
-            const auto textLabel = entity.GetComponent<TextLabelComponent>();
-
-            SDL_Surface* surface = TTF_RenderText_Blended(assetStore->GetFont(textLabel.assetId), textLabel.text.c_str(), textLabel.color);
-            SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-            SDL_FreeSurface(surface);
-
-            int labelWidth = 0;
-            int labelHeight = 0;
-
-            SDL_QueryTexture(texture, NULL, NULL, &labelWidth, &labelHeight);
-
-            SDL_Rect dstRect = {
-                    static_cast<int>(textLabel.position.x - (textLabel.isFixed ? 0 : camera.x)),
-                    static_cast<int>(textLabel.position.y - (textLabel.isFixed ? 0 : camera.y)),
-                    labelWidth,
-                    labelHeight
-            };
-
-            SDL_RenderCopy(renderer, texture, NULL, &dstRect);
-
-            SDL_DestroyTexture(texture);
+            const auto& textLabel = entity.GetComponent<TextLabelComponent>();
+
+            // World labels attached to a sprite follow its visibility, the others are checked against the camera
+            if (!textLabel.isFixed) {
+                if (entity.HasComponent<SpriteComponent>()) {
+                    if (!visibility.IsVisible(entity)) {
+                        continue;
+                    }
+                } else if (textLabel.position.x < camera.x || textLabel.position.x > camera.x + camera.w ||
+                           textLabel.position.y < camera.y || textLabel.position.y > camera.y + camera.h) {
+                    continue;
+                }
+            }
+
+            snapshot.AddText(assetStore->GetFont(textLabel.assetId), textLabel.text, textLabel.color,
+                             static_cast<int>(textLabel.position.x - (textLabel.isFixed ? 0 : camera.x)),
+                             static_cast<int>(textLabel.position.y - (textLabel.isFixed ? 0 : camera.y)));
         }
     }
 };
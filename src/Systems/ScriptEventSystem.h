@@ -0,0 +1,188 @@
+#ifndef SCRIPTEVENTSYSTEM_H
+#define SCRIPTEVENTSYSTEM_H
+
+#include "../ECS/ECS.h"
+#include "../Components/ScriptEventHandlerComponent.h"
+#include "../Components/StreamedComponent.h"
+#include "../EventBus/EventBus.h"
+#include "../Events/CollisionEvent.h"
+#include "../Scripting/ScriptProfiler.h"
+#include <sol/sol.hpp>
+#include <cstddef>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/// Maximum number of kill notification passes per update, the on_killed handlers being able to kill in turn.
+const int SCRIPT_EVENT_MAX_KILL_PASSES = 4;
+
+/// Class responsible for calling the Lua event handlers of the entities.
+/// @details The collisions and the kills are collected through the update, then handed to the handlers at the end
+/// of it, in one call per handler function with the array of the entities concerned. The killed entities are still
+/// alive during their notification, until the next registry update. The entities unloaded by the world streamer are
+/// not notified.
+/// @file ScriptEventSystem.h
+/// @author Maxime Héliot
+/// @version 0.1.0 18/10/2026
+class ScriptEventSystem: public System {
+private:
+    /// Structure holding the events of the update handed to a handler function.
+    struct EventBatch {
+        /// The handler function.
+        sol::function func;
+        /// Lua table of the entities of the events, entities[1..count], kept between updates.
+        sol::table entities;
+        /// Lua table of the entities they collided with, for the collisions only.
+        sol::table others;
+        /// Integer value representing the number of events of the current update.
+        std::size_t count = 0;
+        /// Integer value representing the number of slots filled in the Lua tables by the previous call.
+        std::size_t numSlots = 0;
+    };
+
+    /// Lua state the tables of the batches are created in.
+    lua_State* luaState = nullptr;
+    /// Vector of the collisions of the update, the entity with the handler first.
+    std::vector<std::pair<Entity, Entity>> collisions;
+    /// Vector of the entities to notify of their kill, kept between updates to reuse its storage.
+    std::vector<Entity> killedEntities;
+    /// Map of the batches of the collision handlers, by the address of their Lua function.
+    std::unordered_map<const void*, EventBatch> collisionBatches;
+    /// Map of the batches of the kill handlers, by the address of their Lua function.
+    std::unordered_map<const void*, EventBatch> killBatches;
+
+    /// @brief Add an event to the batch of its handler
+    /// @param other: Pointer to the entity collided with, nullptr for a kill.
+    void AddEvent(std::unordered_map<const void*, EventBatch>& batches, const sol::function& func, Entity entity, const Entity* other) {
+        auto found = batches.find(func.pointer());
+        if (found == batches.end()) {
+            EventBatch batch;
+            batch.func = func;
+            batch.entities = sol::table(luaState, sol::create);
+            if (other) {
+                batch.others = sol::table(luaState, sol::create);
+            }
+            found = batches.emplace(func.pointer(), std::move(batch)).first;
+        }
+
+        EventBatch& batch = found->second;
+        const std::size_t slot = ++batch.count;
+        batch.entities[slot] = entity;
+        if (other) {
+            batch.others[slot] = *other;
+        }
+    }
+
+    /// @brief Call the handlers of the batches holding events, forgetting the others
+    void RunBatches(std::unordered_map<const void*, EventBatch>& batches, ScriptProfiler& profiler) {
+        for (auto it = batches.begin(); it != batches.end();) {
+            EventBatch& batch = it->second;
+            if (batch.count == 0) {
+                // No event for the function this update, release it
+                it = batches.erase(it);
+                continue;
+            }
+
+            // Drop the slots left over by a larger previous call
+            for (std::size_t slot = batch.count + 1; slot <= batch.numSlots; slot++) {
+                batch.entities[slot] = sol::lua_nil;
+                if (batch.others.valid()) {
+                    batch.others[slot] = sol::lua_nil;
+                }
+            }
+            batch.numSlots = batch.count;
+
+            const auto start = profiler.BeginCall();
+            if (batch.others.valid()) {
+                batch.func(batch.entities, batch.others, batch.count);
+            } else {
+                batch.func(batch.entities, batch.count);
+            }
+            profiler.EndCall(batch.func, -1, start);
+            batch.count = 0;
+            ++it;
+        }
+    }
+
+public:
+    /// @brief Default ScriptEventSystem constructor
+    /// @details Base constructor of the ScriptEventSystem class, defining the different required components an entity needs so the system can be interested in.
+    ScriptEventSystem() {
+        RequireComponent<ScriptEventHandlerComponent>();
+    }
+
+    /// @brief Lua state setter
+    /// @details This method is responsible for setting the Lua state the handlers live in, dropping the pending events.
+    void SetLuaState(lua_State* state) {
+        luaState = state;
+        collisions.clear();
+        collisionBatches.clear();
+        killBatches.clear();
+    }
+
+    /// @brief Event subscribing method
+    /// @details This method is responsible for subscribing the class to its interested events.
+    void SubscribeToEvents(std::unique_ptr<EventBus>& eventBus) {
+        eventBus->SubscribeEvent<CollisionEvent>(this, &ScriptEventSystem::OnCollision);
+    }
+
+    /// @brief On collision event handler
+    /// @details This method is responsible for keeping the collision for the handlers of the colliding entities.
+    void OnCollision(CollisionEvent& event) {
+        if (event.a.HasComponent<ScriptEventHandlerComponent>() && event.a.GetComponent<ScriptEventHandlerComponent>().onCollision.valid()) {
+            collisions.emplace_back(event.a, event.b);
+        }
+        if (event.b.HasComponent<ScriptEventHandlerComponent>() && event.b.GetComponent<ScriptEventHandlerComponent>().onCollision.valid()) {
+            collisions.emplace_back(event.b, event.a);
+        }
+    }
+
+    /// @brief Update method
+    /// @details Call the collision handlers with the collisions of the update, then the kill handlers with the
+    /// entities killed so far and not notified yet. Must run after the systems emitting the events and killing the
+    /// entities, before the next registry update.
+    /// @param registry: The registry holding the entities to be killed.
+    /// @param profiler: The script profiler timing the calls, when enabled.
+    void Update(Registry& registry, ScriptProfiler& profiler) {
+        if (!luaState) {
+            collisions.clear();
+            return;
+        }
+
+        for (const auto& collision: collisions) {
+            const auto& handler = collision.first.GetComponent<ScriptEventHandlerComponent>();
+            AddEvent(collisionBatches, handler.onCollision, collision.first, &collision.second);
+        }
+        collisions.clear();
+        RunBatches(collisionBatches, profiler);
+
+        // The kill handlers may kill other entities, notified by the next pass
+        for (int pass = 0; pass < SCRIPT_EVENT_MAX_KILL_PASSES; pass++) {
+            killedEntities.clear();
+            for (const auto& entity: registry.GetEntitiesToBeKilled()) {
+                if (!entity.HasComponent<ScriptEventHandlerComponent>()) {
+                    continue;
+                }
+                if (entity.HasComponent<StreamedComponent>() && entity.GetComponent<StreamedComponent>().isUnloading) {
+                    continue;
+                }
+                auto& handler = entity.GetComponent<ScriptEventHandlerComponent>();
+                if (handler.isKillNotified || !handler.onKilled.valid()) {
+                    continue;
+                }
+                handler.isKillNotified = true;
+                killedEntities.push_back(entity);
+            }
+            if (killedEntities.empty()) {
+                break;
+            }
+
+            for (const auto& entity: killedEntities) {
+                AddEvent(killBatches, entity.GetComponent<ScriptEventHandlerComponent>().onKilled, entity, nullptr);
+            }
+            RunBatches(killBatches, profiler);
+        }
+    }
+};
+
+#endif // SCRIPTEVENTSYSTEM_H //
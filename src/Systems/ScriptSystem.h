@@ -7,12 +7,26 @@
 #include "../Components/RigidBodyComponent.h"
 #include "../Components/AnimationComponent.h"
 #include "../Components/ProjectileEmitterComponent.h"
+#include "../Scripting/ScriptProfiler.h"
+#include "../Scripting/ScriptQueries.h"
+#include "../Scripting/PureScriptRunner.h"
+#include <sol/sol.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+/// Number of slots of the timer wheel of the script system, one slot per update.
+const std::size_t SCRIPT_TIMER_WHEEL_SIZE = 256;
 
 // First declare some native C++ functions that we will bind with Lua functions
 /// TODO: comments
 std::tuple<double, double> GetEntityPosition(Entity entity) {
     if (entity.HasComponent<TransformComponent>()) {
-        const auto transform = entity.GetComponent<TransformComponent>();
+        const auto& transform = entity.GetComponent<TransformComponent>();
         return std::make_tuple(transform.position.x, transform.position.y);
     } else {
         Logger::Err("Trying to get the position of an entity that has no transform component");
@@ -23,7 +37,7 @@ std::tuple<double, double> GetEntityPosition(Entity entity) {
 /// TODO: comments
 std::tuple<double, double> GetEntityVelocity(Entity entity) {
     if (entity.HasComponent<RigidBodyComponent>()) {
-        const auto rigidbody = entity.GetComponent<RigidBodyComponent>();
+        const auto& rigidbody = entity.GetComponent<RigidBodyComponent>();
         return std::make_tuple(rigidbody.velocity.x, rigidbody.velocity.y);
     } else {
         Logger::Err("Trying to get the velocity of an entity that has no rigidbody component");
@@ -37,6 +51,7 @@ void SetEntityPosition(Entity entity, double x, double y) {
         auto& transform = entity.GetComponent<TransformComponent>();
         transform.position.x = x;
         transform.position.y = y;
+        transform.isDirty = true;
     } else {
         Logger::Err("Trying to set the position of an entity that has no transform component.");
     }
@@ -85,22 +100,190 @@ void SetProjectileVelocity(Entity entity, double x, double y) {
     }
 }
 
+/// @brief Component getter for the Lua bindings
+/// @details The component is handed to Lua as a reference to its live storage, so that the scripts read and write
+/// its fields in place. The reference is only valid during the current update, a pool can move its components.
+/// @return A pointer to the component of the entity, nullptr, nil in Lua, if the entity has none.
+template <typename TComponent>
+TComponent* GetEntityComponent(Entity entity) {
+    return entity.HasComponent<TComponent>() ? &entity.GetComponent<TComponent>() : nullptr;
+}
+
+/// @brief Transform getter for the Lua bindings
+/// @details The scripts can move or scale the entity through the returned reference, its bounds are therefore marked
+/// as changed.
+/// @return A pointer to the transform of the entity, nullptr, nil in Lua, if the entity has none.
+inline TransformComponent* GetEntityTransform(Entity entity) {
+    TransformComponent* transform = GetEntityComponent<TransformComponent>(entity);
+    if (transform) {
+        transform->isDirty = true;
+    }
+    return transform;
+}
+
 /// TODO: comments
 class ScriptSystem: public System {
-public:
-    /// TODO: comments
-    ScriptSystem() {
-        RequireComponent<ScriptComponent>();
+private:
+    /// Structure holding the entities sharing a batched script function.
+    struct ScriptBatch {
+        /// The batched script function.
+        sol::function func;
+        /// Lua table handed to the function, entities[1..count], kept between updates to reuse its array part.
+        sol::table entities;
+        /// Vector of the ids of the entities held by the Lua table, to rewrite only the slots that changed.
+        std::vector<int> entityIds;
+        /// Integer value representing the number of entities of the batch at the current update.
+        std::size_t count = 0;
+    };
+
+    /// Structure holding a script waiting in the timer wheel.
+    struct ScheduledScript {
+        /// The entity of the script.
+        Entity entity;
+        /// Integer value representing the ticket of the script, stale once the entity got another script component.
+        unsigned int ticket;
+        /// Integer value representing the update the script is due at.
+        std::uint64_t dueTick;
+    };
+
+    /// Lua state the bindings were created in, used to create the tables of the batches.
+    lua_State* luaState = nullptr;
+    /// Map of the batches, by the address of their Lua function.
+    std::unordered_map<const void*, ScriptBatch> batches;
+    /// Vector of the slots of the timer wheel, a script due in n updates waiting in the slot n updates ahead.
+    /// @details A script due more than a wheel turn ahead stays in its slot through the turns until it is due.
+    std::vector<std::vector<ScheduledScript>> timerWheel = std::vector<std::vector<ScheduledScript>>(SCRIPT_TIMER_WHEEL_SIZE);
+    /// Vector of the scripts due at the current update, kept between updates to reuse its storage.
+    std::vector<ScheduledScript> dueScripts;
+    /// Integer value representing the number of updates so far.
+    std::uint64_t currentTick = 0;
+    /// Integer value representing the ticket handed to the next scheduled script.
+    unsigned int nextTicket = 1;
+    /// Profiler timing the script calls, when enabled.
+    ScriptProfiler profiler;
+    /// Bulk queries and setters of the scripts.
+    ScriptQueries queries;
+    /// Runner of the pure scripts on the worker Lua states.
+    PureScriptRunner pureScripts;
+    /// Vector of the entities with a pure script at the current update, kept between updates to reuse its storage.
+    std::vector<Entity> pureEntities;
+
+    /// @brief Number of updates in a duration getter
+    /// @return The number of updates, at least 1, covering the given duration.
+    static std::uint64_t GetTicks(double seconds, double deltaTime) {
+        if (seconds <= 0.0 || deltaTime <= 0.0) {
+            return 1;
+        }
+        return std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::ceil(seconds / deltaTime - 1e-6)));
     }
 
-    /// TODO: comments
-    void CreateLuaBindings(sol::state& lua) {
-        // Create the "entity" usertype so Lua knows what an entity is
-        lua.new_usertype<Entity>("entity",
-                                 "get_id", &Entity::GetId,
-                                 "destroy", &Entity::Kill,
-                                 "has_tag", &Entity::HasTag,
-                                 "belongs_to_group", &Entity::BelongsToGroup
+    /// @brief Put a script in the timer wheel
+    /// @param ticks: Integer value representing the number of updates from now the script is due in.
+    void Schedule(Entity entity, const ScriptComponent& script, std::uint64_t ticks) {
+        const std::uint64_t dueTick = currentTick + ticks;
+        timerWheel[dueTick % SCRIPT_TIMER_WHEEL_SIZE].push_back({entity, script.ticket, dueTick});
+    }
+
+    /// @brief Run a script of the timer wheel
+    /// @details Call the function of an interval script, or resume the coroutine of a coroutine script until it waits
+    /// or finishes. A finished coroutine starts over after the interval.
+    /// @return The number of updates until the next run of the script, 0 to stop running it.
+    std::uint64_t RunScheduledScript(Entity entity, ScriptComponent& script, double scriptDeltaTime, int ellapsedTime, double deltaTime) {
+        const auto start = profiler.BeginCall();
+        if (!script.isCoroutine) {
+            script.func(entity, scriptDeltaTime, ellapsedTime);
+            profiler.EndCall(script.func, entity.GetId(), start);
+            return GetTicks(script.interval, deltaTime);
+        }
+
+        if (!script.coroutine.valid()) {
+            if (!script.thread.valid()) {
+                script.thread = sol::thread::create(luaState);
+            }
+            script.coroutine = sol::coroutine(script.thread.state(), script.func);
+        }
+
+        // The arguments are handed to the function when it starts, and returned by wait when it resumes
+        sol::protected_function_result result = script.coroutine(entity, scriptDeltaTime, ellapsedTime);
+        profiler.EndCall(script.func, entity.GetId(), start);
+        if (!result.valid()) {
+            sol::error error = result;
+            Logger::Err("Error running the script coroutine of the entity " + std::to_string(entity.GetId()) + ": " + error.what());
+            script.coroutine = sol::lua_nil;
+            return 0;
+        }
+        if (result.status() != sol::call_status::yielded) {
+            script.coroutine = sol::lua_nil;
+            return GetTicks(script.interval, deltaTime);
+        }
+
+        // Waiting through wait(seconds) or wait_frames(frames), a bare yield waits for the next update
+        const double seconds = result.get<sol::optional<double>>(0).value_or(0.0);
+        const int frames = result.get<sol::optional<int>>(1).value_or(0);
+        return frames > 0 ? static_cast<std::uint64_t>(frames) : GetTicks(seconds, deltaTime);
+    }
+
+    /// @brief Run the scripts of the timer wheel due at the current update
+    void RunDueScripts(double deltaTime, int ellapsedTime) {
+        // Take the due scripts out of the slot first, running them may schedule new ones in the same slot
+        auto& slot = timerWheel[currentTick % SCRIPT_TIMER_WHEEL_SIZE];
+        dueScripts.clear();
+        std::size_t numWaiting = 0;
+        for (const auto& scheduled: slot) {
+            if (scheduled.dueTick <= currentTick) {
+                dueScripts.push_back(scheduled);
+            } else {
+                slot[numWaiting++] = scheduled;
+            }
+        }
+        slot.erase(slot.begin() + numWaiting, slot.end());
+
+        for (const auto& scheduled: dueScripts) {
+            // The entity may have been killed, or its id handed to another entity, since it was scheduled
+            if (!scheduled.entity.HasComponent<ScriptComponent>()) {
+                continue;
+            }
+            auto& script = scheduled.entity.GetComponent<ScriptComponent>();
+            if (script.ticket != scheduled.ticket) {
+                continue;
+            }
+
+            const double scriptDeltaTime = static_cast<double>(currentTick - script.lastRunTick) * deltaTime;
+            script.lastRunTick = currentTick;
+            const std::uint64_t ticks = RunScheduledScript(scheduled.entity, script, scriptDeltaTime, ellapsedTime, deltaTime);
+            if (ticks > 0) {
+                Schedule(scheduled.entity, script, ticks);
+            }
+        }
+    }
+
+    /// @brief Create the Lua bindings shared by the main and the worker Lua states
+    /// @details The component usertypes, their fields being read and written in the component storage, and the
+    /// native getters and setters of an entity.
+    static void CreateComponentBindings(sol::state& lua) {
+        // Create the component usertypes, their fields are read and written in the component storage
+        lua.new_usertype<glm::vec2>("vec2",
+                                    sol::no_constructor,
+                                    "x", &glm::vec2::x,
+                                    "y", &glm::vec2::y
+        );
+        lua.new_usertype<TransformComponent>("transform",
+                                             sol::no_constructor,
+                                             "position", &TransformComponent::position,
+                                             "scale", &TransformComponent::scale,
+                                             "rotation", &TransformComponent::rotation
+        );
+        lua.new_usertype<RigidBodyComponent>("rigidbody",
+                                             sol::no_constructor,
+                                             "velocity", &RigidBodyComponent::velocity
+        );
+        lua.new_usertype<ProjectileEmitterComponent>("projectile_emitter",
+                                                     sol::no_constructor,
+                                                     "projectile_velocity", &ProjectileEmitterComponent::projectileVelocity,
+                                                     "repeat_frequency", &ProjectileEmitterComponent::repeatFrequency,
+                                                     "projectile_duration", &ProjectileEmitterComponent::projectileDuration,
+                                                     "hit_percent_damage", &ProjectileEmitterComponent::hitPercentDamage,
+                                                     "is_friendly", &ProjectileEmitterComponent::isFriendly
         );
 
         // Create all the bindings between C++ and Lua functions
@@ -113,12 +296,172 @@ public:
         lua.set_function("set_animation_frame", SetEntityAnimationFrame);
     }
 
+    /// @brief Create the Lua bindings of a worker Lua state
+    /// @details Only what touches the entity the script runs for is bound, the kills being deferred.
+    /// @param deferredKills: Vector receiving the entities the scripts of the state ask to kill.
+    static void CreatePureLuaBindings(sol::state& lua, std::vector<Entity>& deferredKills) {
+        CreateComponentBindings(lua);
+        lua.new_usertype<Entity>("entity",
+                                 "get_id", &Entity::GetId,
+                                 "destroy", [&deferredKills](Entity entity) { deferredKills.push_back(entity); },
+                                 "has_tag", &Entity::HasTag,
+                                 "belongs_to_group", &Entity::BelongsToGroup,
+                                 "transform", sol::property(&GetEntityTransform),
+                                 "rigidbody", sol::property(&GetEntityComponent<RigidBodyComponent>),
+                                 "projectile_emitter", sol::property(&GetEntityComponent<ProjectileEmitterComponent>)
+        );
+    }
+
+public:
     /// TODO: comments
+    ScriptSystem(): pureScripts(&ScriptSystem::CreatePureLuaBindings) {
+        RequireComponent<ScriptComponent>();
+    }
+
+    /// @brief Create the Lua bindings
+    /// @details This method is responsible for exposing the entities and their components to the Lua scripts.
+    /// @param registry: The registry the bulk queries run on.
+    void CreateLuaBindings(sol::state& lua, Registry& registry) {
+        luaState = lua.lua_state();
+        batches.clear();
+
+        CreateComponentBindings(lua);
+
+        // Create the "entity" usertype so Lua knows what an entity is
+        lua.new_usertype<Entity>("entity",
+                                 "get_id", &Entity::GetId,
+                                 "destroy", &Entity::Kill,
+                                 "has_tag", &Entity::HasTag,
+                                 "belongs_to_group", &Entity::BelongsToGroup,
+                                 "transform", sol::property(&GetEntityTransform),
+                                 "rigidbody", sol::property(&GetEntityComponent<RigidBodyComponent>),
+                                 "projectile_emitter", sol::property(&GetEntityComponent<ProjectileEmitterComponent>)
+        );
+
+        // Create the bulk queries and setters, crossing into C++ once for a whole group of entities
+        queries.CreateLuaBindings(lua, registry);
+
+        // Create the waits of the coroutine scripts, yielding what the script system reschedules them with
+        lua.set_function("wait", sol::yielding([](double seconds) {
+            return std::make_tuple(seconds, 0);
+        }));
+        lua.set_function("wait_frames", sol::yielding([](int frames) {
+            return std::make_tuple(0.0, frames);
+        }));
+    }
+
+    /// @brief Level setter
+    /// @details This method is responsible for creating the worker Lua states of the pure scripts from the given
+    /// level, when it has any, to be called once the level is loaded or reloaded.
+    /// @param numPureScripts: Integer value representing the number of pure scripts of the level.
+    /// @return A boolean value representing the success status of the worker states, false for the pure scripts to
+    /// run on the main Lua state.
+    bool SetLevel(int levelNumber, std::size_t numPureScripts) {
+        return pureScripts.SetLevel(levelNumber, numPureScripts);
+    }
+
+    /// @brief Script profiler getter
+    ScriptProfiler& GetProfiler() {
+        return profiler;
+    }
+
+    /// @brief Update method
+    /// @details Invoke the Lua function of every entity with a script component. The batched functions are called
+    /// once, after the others, with the array of the entities sharing them: function(entities, count, dt, t). The
+    /// interval and coroutine scripts run last, only when their timer expired, with the time since their previous run.
+    /// @param deltaTime: Double value representing the time elapsed since the previous update, in seconds.
+    /// @param ellapsedTime: Integer value representing the time elapsed since the start of the game, in milliseconds.
     void Update(double deltaTime, int ellapsedTime) {
-        // Loop all entities that have a script component and invoke their Lua function
+        currentTick++;
+
+        for (auto& batch: batches) {
+            batch.second.count = 0;
+        }
+
         for (auto entity: GetSystemEntities()) {
-            const auto script = entity.GetComponent<ScriptComponent>();
-            script.func(entity, deltaTime, ellapsedTime);
+            const auto& script = entity.GetComponent<ScriptComponent>();
+            if (script.ticket != 0) {
+                // Run from the timer wheel
+                continue;
+            }
+            if (script.isPure && !script.isBatched && script.levelEntityIndex >= 0) {
+                // Run in parallel once every entity is known
+                pureEntities.push_back(entity);
+                continue;
+            }
+            if (!script.isBatched || !luaState) {
+                const auto start = profiler.BeginCall();
+                script.func(entity, deltaTime, ellapsedTime);
+                profiler.EndCall(script.func, entity.GetId(), start);
+                continue;
+            }
+
+            // Entities sharing a function share a batch, the function being compared by its Lua address
+            auto found = batches.find(script.func.pointer());
+            if (found == batches.end()) {
+                ScriptBatch batch;
+                batch.func = script.func;
+                batch.entities = sol::table(luaState, sol::create);
+                found = batches.emplace(script.func.pointer(), std::move(batch)).first;
+            }
+            ScriptBatch& batch = found->second;
+
+            // Only create a new entity userdata for the slots whose entity changed since the previous update
+            const std::size_t slot = batch.count++;
+            if (slot == batch.entityIds.size()) {
+                batch.entityIds.push_back(-1);
+            }
+            if (batch.entityIds[slot] != entity.GetId()) {
+                batch.entityIds[slot] = entity.GetId();
+                batch.entities[slot + 1] = entity;
+            }
+        }
+
+        // Without worker Lua states, the pure scripts run on the main one like the others
+        if (!pureEntities.empty() && !pureScripts.Run(pureEntities, deltaTime, ellapsedTime)) {
+            for (auto entity: pureEntities) {
+                const auto& script = entity.GetComponent<ScriptComponent>();
+                const auto start = profiler.BeginCall();
+                script.func(entity, deltaTime, ellapsedTime);
+                profiler.EndCall(script.func, entity.GetId(), start);
+            }
+        }
+        pureEntities.clear();
+
+        for (auto it = batches.begin(); it != batches.end();) {
+            ScriptBatch& batch = it->second;
+            if (batch.count == 0) {
+                // No entity uses the function anymore
+                it = batches.erase(it);
+                continue;
+            }
+
+            // Drop the slots left over by the entities gone since the previous update
+            for (std::size_t slot = batch.count; slot < batch.entityIds.size(); slot++) {
+                batch.entities[slot + 1] = sol::lua_nil;
+            }
+            batch.entityIds.resize(batch.count);
+
+            const auto start = profiler.BeginCall();
+            batch.func(batch.entities, batch.count, deltaTime, ellapsedTime);
+            profiler.EndCall(batch.func, -1, start);
+            ++it;
+        }
+
+        RunDueScripts(deltaTime, ellapsedTime);
+    }
+
+protected:
+    /// @brief Put the interval and coroutine scripts in the timer wheel, due at the next update
+    void OnEntityAdded(Entity entity) override {
+        auto& script = entity.GetComponent<ScriptComponent>();
+        if ((script.interval > 0.0 || script.isCoroutine) && luaState) {
+            script.ticket = nextTicket++;
+            if (nextTicket == 0) {
+                nextTicket = 1;
+            }
+            script.lastRunTick = currentTick;
+            Schedule(entity, script, 1);
         }
     }
 };
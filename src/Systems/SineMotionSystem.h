@@ -0,0 +1,40 @@
+#ifndef SINEMOTIONSYSTEM_H
+#define SINEMOTIONSYSTEM_H
+
+#include "../ECS/ECS.h"
+#include "../Components/TransformComponent.h"
+#include "../Components/SineMotionComponent.h"
+#include <cmath>
+
+/// Class responsible to move the entities flying along waves or circles, in place of their Lua scripts.
+/// @file SineMotionSystem.h
+/// @author Maxime Héliot
+/// @version 0.1.0 18/10/2026
+class SineMotionSystem: public System {
+public:
+    /// @brief Default SineMotionSystem constructor
+    /// @details Base constructor of the SineMotionSystem class, defining the different required components an entity needs so the system can be interested in.
+    SineMotionSystem() {
+        RequireComponent<TransformComponent>();
+        RequireComponent<SineMotionComponent>();
+    }
+
+    /// @brief System update motion method
+    /// @details This method is responsible for advancing the motion of all its entities and placing them along it,
+    /// whatever their rigid body did.
+    /// @param deltaTime: Double value representing the time simulated by the tick, in seconds.
+    void Update(double deltaTime) {
+        for (auto entity: GetSystemEntities()) {
+            auto& motion = entity.GetComponent<SineMotionComponent>();
+            auto& transform = entity.GetComponent<TransformComponent>();
+
+            motion.time += deltaTime;
+            const float time = static_cast<float>(motion.time);
+            transform.position.x = motion.origin.x + motion.velocity.x * time + motion.amplitude.x * std::sin(motion.frequency.x * time + motion.phase.x);
+            transform.position.y = motion.origin.y + motion.velocity.y * time + motion.amplitude.y * std::sin(motion.frequency.y * time + motion.phase.y);
+            transform.isDirty = true;
+        }
+    }
+};
+
+#endif // SINEMOTIONSYSTEM_H //
@@ -0,0 +1,52 @@
+#ifndef STREAMINGSYSTEM_H
+#define STREAMINGSYSTEM_H
+
+#include "../ECS/ECS.h"
+#include "../Components/StreamedComponent.h"
+#include "../Streaming/WorldStreamer.h"
+#include <SDL.h>
+#include <memory>
+
+/// Class responsible to stream the world chunks in and out around the camera.
+/// @details The system drives the world streamer of the level, when there is one, and tells it about the streamed
+/// entities leaving the registry, so that the ones destroyed in game are not brought back with their chunk.
+/// @file StreamingSystem.h
+/// @author Maxime Héliot
+/// @version 0.1.0 18/10/2026
+class StreamingSystem: public System {
+private:
+    /// Pointer to the world streamer of the current level, nullptr when the world is not streamed.
+    WorldStreamer* worldStreamer = nullptr;
+
+public:
+    /// @brief Default StreamingSystem constructor
+    /// @details Base constructor of the StreamingSystem class, defining the different required components an entity needs so the system can be interested in.
+    StreamingSystem() {
+        RequireComponent<StreamedComponent>();
+    }
+
+    /// @brief World streamer setter
+    /// @param streamer: The world streamer to drive, nullptr to stop streaming.
+    void SetWorldStreamer(WorldStreamer* streamer) {
+        worldStreamer = streamer;
+    }
+
+    /// @brief System update streaming method
+    /// @details This method is responsible for activating the chunks the camera reaches and deactivating the ones it left.
+    /// @param camera: SDL Rectangle object defining the camera canvas, once moved for the current tick.
+    void Update(const std::unique_ptr<Registry>& registry, const SDL_Rect& camera) {
+        if (worldStreamer) {
+            worldStreamer->Update(*registry, camera);
+        }
+    }
+
+protected:
+    /// @brief Forget a streamed entity leaving the registry
+    void OnEntityRemoved(Entity entity) override {
+        if (worldStreamer) {
+            worldStreamer->OnEntityRemoved(entity, entity.GetComponent<StreamedComponent>());
+        }
+    }
+};
+
+#endif // STREAMINGSYSTEM_H //
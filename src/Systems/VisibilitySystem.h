@@ -0,0 +1,157 @@
+#ifndef VISIBILITYSYSTEM_H
+#define VISIBILITYSYSTEM_H
+
+#include "../ECS/ECS.h"
+#include "../Game/Game.h"
+#include "../Spatial/LooseQuadTree.h"
+#include "../Components/TransformComponent.h"
+#include "../Components/SpriteComponent.h"
+#include <SDL.h>
+#include <vector>
+#include <algorithm>
+
+/// Class responsible to compute, once per frame, the set of entities visible through the camera.
+/// @details The sprite bounds of the entities are indexed in a loose quadtree kept up to date as they join and
+/// leave the system, only the entities whose transform was marked dirty since the previous frame being moved in it.
+/// The camera rectangle is then queried against it. Fixed sprites are kept apart, always visible. Every render
+/// related system walks the resulting visible set instead of its own entities.
+/// @file VisibilitySystem.h
+/// @author Maxime Héliot
+/// @version 0.1.0 18/10/2026
+class VisibilitySystem: public System {
+private:
+    /// LooseQuadTree object indexing the sprite bounds of the world entities by entity id.
+    LooseQuadTree quadTree;
+    /// Registry owning the indexed entities, to hand back full entity objects from the quadtree ids.
+    Registry* registry = nullptr;
+    /// Vector of the entities drawn in screen space, kept out of the quadtree.
+    std::vector<Entity> fixedEntities;
+    /// Vector of entity ids returned by the last quadtree query.
+    std::vector<int> queryResult;
+    /// Vector of the entities visible during the current frame.
+    std::vector<Entity> visibleEntities;
+    /// Vector of the frame number an entity was last seen visible.
+    /// @details visibleFrame[index = entity id]
+    std::vector<unsigned int> visibleFrame;
+    /// Integer value representing the number of the current frame.
+    unsigned int currentFrame = 0;
+
+public:
+    /// @brief Default VisibilitySystem constructor
+    /// @details Base constructor of the VisibilitySystem class, defining the different required components an entity needs so the system can be interested in.
+    VisibilitySystem() {
+        RequireComponent<TransformComponent>();
+        RequireComponent<SpriteComponent>();
+    }
+
+    /// @brief Entity added hook
+    /// @details This method is responsible for indexing the sprite bounds of the entity.
+    void OnEntityAdded(Entity entity) override {
+        registry = entity.registry;
+        if (entity.GetComponent<SpriteComponent>().isFixed) {
+            fixedEntities.push_back(entity);
+            return;
+        }
+        Index(entity);
+    }
+
+    /// @brief Entity removed hook
+    /// @details This method is responsible for removing the entity from the index.
+    void OnEntityRemoved(Entity entity) override {
+        quadTree.Remove(entity.GetId());
+        auto fixedEntity = std::find(fixedEntities.begin(), fixedEntities.end(), entity);
+        if (fixedEntity != fixedEntities.end()) {
+            *fixedEntity = fixedEntities.back();
+            fixedEntities.pop_back();
+        }
+    }
+
+    /// @brief System update visibility method
+    /// @details This method is responsible for moving the entities whose bounds changed in the spatial index and
+    /// querying it with the camera view.
+    /// @param camera: SDL Rectangle object defining the camera canvas.
+    void Update(const SDL_Rect& camera) {
+        currentFrame++;
+        visibleEntities.clear();
+        queryResult.clear();
+
+        // Follow the map size so that the tree cells stay proportional to the level, indexing every entity again
+        const float worldWidth = static_cast<float>(std::max(Game::mapWidth, 1));
+        const float worldHeight = static_cast<float>(std::max(Game::mapHeight, 1));
+        const bool isReset = worldWidth != quadTree.GetWorldWidth() || worldHeight != quadTree.GetWorldHeight();
+        if (isReset) {
+            quadTree.Reset(worldWidth, worldHeight);
+        }
+
+        // Only the entities moved or scaled since the previous frame are indexed again
+        for (auto entity: GetSystemEntities()) {
+            if ((isReset || entity.GetComponent<TransformComponent>().isDirty) &&
+                !entity.GetComponent<SpriteComponent>().isFixed) {
+                Index(entity);
+            }
+        }
+
+        // Fixed sprites are drawn in screen space and are therefore always visible
+        for (auto entity: fixedEntities) {
+            MarkVisible(entity);
+        }
+
+        quadTree.Query({
+                static_cast<float>(camera.x),
+                static_cast<float>(camera.y),
+                static_cast<float>(camera.w),
+                static_cast<float>(camera.h)
+        }, queryResult);
+
+        for (auto entityId: queryResult) {
+            Entity entity(entityId);
+            entity.registry = registry;
+            MarkVisible(entity);
+        }
+    }
+
+    /// @brief Visible entities accessor
+    /// @details This method is responsible to access the entities visible during the current frame.
+    /// @return The list of visible entities.
+    const std::vector<Entity>& GetVisibleEntities() const {
+        return visibleEntities;
+    }
+
+    /// @brief Check entity visibility
+    /// @details This method is responsible for checking if the given entity is part of the current frame visible set.
+    /// @param entity: Entity object to check the visibility of.
+    /// @return A boolean value representing the visibility status of the entity.
+    bool IsVisible(Entity entity) const {
+        const int entityId = entity.GetId();
+        return entityId >= 0 && entityId < static_cast<int>(visibleFrame.size()) && visibleFrame[entityId] == currentFrame;
+    }
+
+private:
+    /// @brief Index the sprite bounds of an entity
+    /// @details The transform of the entity is marked as seen by the index.
+    /// @param entity: Entity object to index, holding a transform and a sprite that is not fixed.
+    void Index(Entity entity) {
+        auto& transform = entity.GetComponent<TransformComponent>();
+        const auto& sprite = entity.GetComponent<SpriteComponent>();
+        quadTree.Insert(entity.GetId(), {
+                transform.position.x,
+                transform.position.y,
+                static_cast<float>(sprite.width * transform.scale.x),
+                static_cast<float>(sprite.height * transform.scale.y)
+        });
+        transform.isDirty = false;
+    }
+
+    /// @brief Add an entity to the visible set
+    /// @param entity: Entity object visible during the current frame.
+    void MarkVisible(Entity entity) {
+        const auto entityId = entity.GetId();
+        if (entityId >= static_cast<int>(visibleFrame.size())) {
+            visibleFrame.resize(entityId + 1, 0);
+        }
+        visibleFrame[entityId] = currentFrame;
+        visibleEntities.push_back(entity);
+    }
+};
+
+#endif // VISIBILITYSYSTEM_H //
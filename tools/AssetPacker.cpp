@@ -0,0 +1,183 @@
+#include "../src/AssetStore/AssetArchive.h"
+#include "../src/AssetStore/Tilemap.h"
+#include <SDL.h>
+#include <SDL_image.h>
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+/// Directories of the assets folder packed in the archive.
+const char* const PACKED_DIRECTORIES[] = {"images", "tilemaps", "fonts", "sounds"};
+
+/// Structure holding an asset waiting to be written in the archive.
+struct PackedAsset {
+    /// String object representing the key of the asset, its path relative to the assets directory.
+    std::string key;
+    /// AssetArchiveEntry object describing the asset, offsets filled in at write time.
+    AssetArchiveEntry entry;
+    /// Vector of the bytes to store for the asset.
+    std::vector<unsigned char> data;
+};
+
+/// @brief Decode an image to tightly packed RGBA32 pixels.
+/// @return A boolean value representing the success status of the decoding.
+bool DecodeImage(const fs::path& filePath, PackedAsset& asset) {
+    SDL_Surface* image = IMG_Load(filePath.string().c_str());
+    if (!image) {
+        std::cerr << "Cannot decode " << filePath.string() << ": " << IMG_GetError() << std::endl;
+        return false;
+    }
+    SDL_Surface* pixels = SDL_ConvertSurfaceFormat(image, SDL_PIXELFORMAT_RGBA32, 0);
+    SDL_FreeSurface(image);
+    if (!pixels) {
+        std::cerr << "Cannot convert " << filePath.string() << ": " << SDL_GetError() << std::endl;
+        return false;
+    }
+
+    // Drop the row padding so that the pitch is always four bytes per pixel
+    const std::size_t rowSize = static_cast<std::size_t>(pixels->w) * 4;
+    asset.data.resize(rowSize * pixels->h);
+    for (int y = 0; y < pixels->h; y++) {
+        std::memcpy(asset.data.data() + y * rowSize, static_cast<const unsigned char*>(pixels->pixels) + y * pixels->pitch, rowSize);
+    }
+    asset.entry.type = ARCHIVE_ENTRY_PIXELS;
+    asset.entry.width = pixels->w;
+    asset.entry.height = pixels->h;
+    SDL_FreeSurface(pixels);
+    return true;
+}
+
+/// @brief Read a file as is.
+/// @return A boolean value representing the success status of the read.
+bool ReadRaw(const fs::path& filePath, PackedAsset& asset) {
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file) {
+        std::cerr << "Cannot read " << filePath.string() << std::endl;
+        return false;
+    }
+    asset.data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    asset.entry.type = ARCHIVE_ENTRY_RAW;
+    asset.entry.width = 0;
+    asset.entry.height = 0;
+    return true;
+}
+
+/// @brief Convert a text tilemap to the binary tilemap format, kept under the key of the text file.
+/// @return A boolean value representing the success status of the conversion.
+bool ConvertTilemap(const fs::path& filePath, PackedAsset& asset) {
+    Tilemap tilemap;
+    if (!tilemap.LoadFromFile(filePath.string())) {
+        std::cerr << "Cannot parse " << filePath.string() << ": " << tilemap.GetError() << std::endl;
+        return false;
+    }
+    tilemap.WriteBinary(asset.data);
+    asset.entry.type = ARCHIVE_ENTRY_RAW;
+    asset.entry.width = 0;
+    asset.entry.height = 0;
+    return true;
+}
+
+/// @brief Pad the output file with zeros up to the archive alignment.
+void Align(std::ofstream& output) {
+    const auto position = static_cast<std::size_t>(output.tellp());
+    const std::size_t padding = (ASSET_ARCHIVE_ALIGNMENT - position % ASSET_ARCHIVE_ALIGNMENT) % ASSET_ARCHIVE_ALIGNMENT;
+    const char zeros[ASSET_ARCHIVE_ALIGNMENT] = {};
+    output.write(zeros, padding);
+}
+
+/// Offline asset packer: decodes the images, converts the tilemaps to their binary format and gathers them with the
+/// fonts and sounds of the assets directory in a single memory mappable archive, loaded by the engine instead of the
+/// loose files when present.
+/// Usage: paperCraftAssetPacker [assets directory] [archive file]
+int main(int argc, char* argv[])
+{
+    const fs::path assetsDirectory = argc > 1 ? argv[1] : "./../assets";
+    const fs::path archivePath = argc > 2 ? argv[2] : "./../assets.pcpk";
+
+    if (IMG_Init(IMG_INIT_PNG) == 0) {
+        std::cerr << "Error initializing SDL_image: " << IMG_GetError() << std::endl;
+        return 1;
+    }
+
+    std::vector<PackedAsset> assets;
+    for (const char* directory: PACKED_DIRECTORIES) {
+        const fs::path directoryPath = assetsDirectory / directory;
+        if (!fs::is_directory(directoryPath)) {
+            continue;
+        }
+        for (const auto& file: fs::recursive_directory_iterator(directoryPath)) {
+            if (!file.is_regular_file()) {
+                continue;
+            }
+            PackedAsset asset;
+            asset.key = AssetArchive::MakeKey(fs::relative(file.path(), assetsDirectory).generic_string());
+            const auto extension = file.path().extension();
+            bool isPacked;
+            if (extension == ".png") {
+                isPacked = DecodeImage(file.path(), asset);
+            } else if (extension == ".map") {
+                isPacked = ConvertTilemap(file.path(), asset);
+            } else {
+                isPacked = ReadRaw(file.path(), asset);
+            }
+            if (!isPacked) {
+                IMG_Quit();
+                return 1;
+            }
+            assets.push_back(std::move(asset));
+        }
+    }
+
+    // Sorted keys keep the archive identical from one run to another
+    std::sort(assets.begin(), assets.end(), [](const PackedAsset& a, const PackedAsset& b) { return a.key < b.key; });
+
+    std::string stringTable;
+    for (auto& asset: assets) {
+        asset.entry.keyOffset = static_cast<std::uint32_t>(stringTable.size());
+        stringTable += asset.key;
+        stringTable += '\0';
+    }
+
+    // Blobs start after the tables, each on an aligned offset
+    std::uint64_t dataOffset = sizeof(AssetArchiveHeader) + assets.size() * sizeof(AssetArchiveEntry) + stringTable.size();
+    for (auto& asset: assets) {
+        dataOffset = (dataOffset + ASSET_ARCHIVE_ALIGNMENT - 1) / ASSET_ARCHIVE_ALIGNMENT * ASSET_ARCHIVE_ALIGNMENT;
+        asset.entry.dataOffset = dataOffset;
+        asset.entry.dataSize = asset.data.size();
+        dataOffset += asset.data.size();
+    }
+
+    std::ofstream output(archivePath, std::ios::binary);
+    if (!output) {
+        std::cerr << "Cannot create " << archivePath.string() << std::endl;
+        IMG_Quit();
+        return 1;
+    }
+
+    AssetArchiveHeader header;
+    std::memcpy(header.magic, ASSET_ARCHIVE_MAGIC, sizeof(header.magic));
+    header.version = ASSET_ARCHIVE_VERSION;
+    header.numEntries = static_cast<std::uint32_t>(assets.size());
+    header.stringTableSize = static_cast<std::uint32_t>(stringTable.size());
+    output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (const auto& asset: assets) {
+        output.write(reinterpret_cast<const char*>(&asset.entry), sizeof(asset.entry));
+    }
+    output.write(stringTable.data(), stringTable.size());
+    for (const auto& asset: assets) {
+        Align(output);
+        output.write(reinterpret_cast<const char*>(asset.data.data()), asset.data.size());
+    }
+    output.close();
+
+    std::cout << "Packed " << assets.size() << " assets in " << archivePath.string() << " (" << dataOffset << " bytes)" << std::endl;
+    IMG_Quit();
+    return output ? 0 : 1;
+}